@@ -6,27 +6,15 @@ public class GeoBlueprintJson : ModuleRules
     {
         PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
 
+        // Runtime object <-> JSON conversion only. Anything that needs editor data lives in GeoBlueprintJsonEditor.
         PublicDependencyModuleNames.AddRange(
             new string[]
             {
                 "Core",
                 "CoreUObject",
                 "Engine",
-                "Json",
-                "JsonUtilities",
-                "BlueprintGraph"
-            }
-        );
-
-        PrivateDependencyModuleNames.AddRange(
-            new string[]
-            {
-                "Slate",
-                "SlateCore",
-                "GraphEditor",
-                "KismetCompiler",
-                "UnrealEd"
+                "Json"
             }
         );
     }
-} 
\ No newline at end of file
+}
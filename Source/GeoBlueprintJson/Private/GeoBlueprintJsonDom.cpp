@@ -0,0 +1,310 @@
+#include "GeoBlueprintJsonDom.h"
+#include "GeoBlueprintJsonUtf8Writer.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+
+FGeoJsonArena::FGeoJsonArena(SIZE_T InPageSize)
+    : PageSize(InPageSize)
+{
+}
+
+FGeoJsonArena::~FGeoJsonArena()
+{
+    for (const FPage& Page : Pages)
+    {
+        FMemory::Free(Page.Memory);
+    }
+}
+
+void FGeoJsonArena::AllocatePage(SIZE_T MinSize)
+{
+    // Oversized requests get a page of their own so they don't waste the remainder of a regular page
+    const SIZE_T Size = FMath::Max(PageSize, MinSize);
+    uint8* Memory = static_cast<uint8*>(FMemory::Malloc(Size, 16));
+    Pages.Add(FPage{ Memory, Size });
+    Cursor = Memory;
+    End = Memory + Size;
+    BytesReserved += Size;
+}
+
+void* FGeoJsonArena::Alloc(SIZE_T Size, SIZE_T Alignment)
+{
+    uint8* Result = Align(Cursor, Alignment);
+    if (!Cursor || Result + Size > End)
+    {
+        AllocatePage(Size + Alignment);
+        Result = Align(Cursor, Alignment);
+    }
+    Cursor = Result + Size;
+    BytesUsed += Size;
+    return Result;
+}
+
+FStringView FGeoJsonArena::CopyString(FStringView String)
+{
+    const int32 Len = String.Len();
+    TCHAR* Copy = static_cast<TCHAR*>(Alloc(sizeof(TCHAR) * (Len + 1), alignof(TCHAR)));
+    if (Len > 0)
+    {
+        FMemory::Memcpy(Copy, String.GetData(), sizeof(TCHAR) * Len);
+    }
+    Copy[Len] = TCHAR('\0');
+    return FStringView(Copy, Len);
+}
+
+void FGeoJsonArena::Reset()
+{
+    if (Pages.Num() == 0)
+    {
+        return;
+    }
+
+    for (int32 Index = 1; Index < Pages.Num(); ++Index)
+    {
+        FMemory::Free(Pages[Index].Memory);
+    }
+    Pages.SetNum(1);
+
+    Cursor = Pages[0].Memory;
+    End = Pages[0].Memory + Pages[0].Size;
+    BytesUsed = 0;
+    BytesReserved = Pages[0].Size;
+}
+
+FGeoJsonValue FGeoJsonValue::MakeString(FGeoJsonArena& Arena, FStringView InString)
+{
+    const FStringView Copy = Arena.CopyString(InString);
+
+    FGeoJsonValue Value;
+    Value.Type = EGeoJsonType::String;
+    Value.String = FGeoJsonStringRef{ Copy.GetData(), Copy.Len() };
+    return Value;
+}
+
+TSharedPtr<FJsonValue> FGeoJsonValue::ToJsonValue() const
+{
+    switch (Type)
+    {
+    case EGeoJsonType::Bool:
+        return MakeShared<FJsonValueBoolean>(Bool);
+    case EGeoJsonType::Number:
+        return MakeShared<FJsonValueNumber>(Number);
+    case EGeoJsonType::String:
+        return MakeShared<FJsonValueString>(FString(String.View()));
+    case EGeoJsonType::Array:
+        return MakeShared<FJsonValueArray>(Array->ToJsonValues());
+    case EGeoJsonType::Object:
+        return MakeShared<FJsonValueObject>(Object->ToJsonObject());
+    default:
+        return MakeShared<FJsonValueNull>();
+    }
+}
+
+FGeoJsonObject* FGeoJsonArray::AddObject()
+{
+    FGeoJsonObject* Object = Arena->New<FGeoJsonObject>(*Arena);
+    AddObject(Object);
+    return Object;
+}
+
+FGeoJsonArray* FGeoJsonArray::AddArray()
+{
+    FGeoJsonArray* Array = Arena->New<FGeoJsonArray>(*Arena);
+    Values.Add(*Arena, FGeoJsonValue::MakeArray(Array));
+    return Array;
+}
+
+TArray<TSharedPtr<FJsonValue>> FGeoJsonArray::ToJsonValues() const
+{
+    TArray<TSharedPtr<FJsonValue>> Result;
+    Result.Reserve(Values.Num);
+    for (const FGeoJsonValue& Value : Values)
+    {
+        Result.Add(Value.ToJsonValue());
+    }
+    return Result;
+}
+
+FGeoJsonObject* FGeoJsonObject::SetObjectField(FStringView Key)
+{
+    FGeoJsonObject* Object = Arena->New<FGeoJsonObject>(*Arena);
+    SetObjectField(Key, Object);
+    return Object;
+}
+
+FGeoJsonArray* FGeoJsonObject::SetArrayField(FStringView Key)
+{
+    FGeoJsonArray* Array = Arena->New<FGeoJsonArray>(*Arena);
+    SetArrayField(Key, Array);
+    return Array;
+}
+
+void FGeoJsonObject::SetField(FStringView Key, const FGeoJsonValue& Value)
+{
+    // Exporters set each key once, so the scan only runs where slow checks are enabled
+    checkSlow(!FindField(Key));
+
+    const FStringView KeyCopy = Arena->CopyString(Key);
+    Fields.Add(*Arena, FGeoJsonField{ FGeoJsonStringRef{ KeyCopy.GetData(), KeyCopy.Len() }, Value });
+}
+
+void FGeoJsonObject::ReplaceField(FStringView Key, const FGeoJsonValue& Value)
+{
+    for (FGeoJsonField& Field : Fields)
+    {
+        if (Field.Key.View().Equals(Key, ESearchCase::CaseSensitive))
+        {
+            Field.Value = Value;
+            return;
+        }
+    }
+
+    const FStringView KeyCopy = Arena->CopyString(Key);
+    Fields.Add(*Arena, FGeoJsonField{ FGeoJsonStringRef{ KeyCopy.GetData(), KeyCopy.Len() }, Value });
+}
+
+const FGeoJsonValue* FGeoJsonObject::FindField(FStringView Key) const
+{
+    for (const FGeoJsonField& Field : Fields)
+    {
+        if (Field.Key.View().Equals(Key, ESearchCase::CaseSensitive))
+        {
+            return &Field.Value;
+        }
+    }
+    return nullptr;
+}
+
+TSharedRef<FJsonObject> FGeoJsonObject::ToJsonObject() const
+{
+    TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->Values.Reserve(Fields.Num);
+    for (const FGeoJsonField& Field : Fields)
+    {
+        Result->SetField(FString(Field.Key.View()), Field.Value.ToJsonValue());
+    }
+    return Result;
+}
+
+namespace GeoJsonDom
+{
+    template <class PrintPolicy>
+    void WriteValue(TJsonWriter<TCHAR, PrintPolicy>& Writer, const FGeoJsonValue& Value);
+
+    template <class PrintPolicy>
+    void WriteObject(TJsonWriter<TCHAR, PrintPolicy>& Writer, const FGeoJsonObject& Object)
+    {
+        for (const FGeoJsonField& Field : Object.Fields)
+        {
+            const FStringView Key = Field.Key.View();
+            switch (Field.Value.Type)
+            {
+            case EGeoJsonType::Bool:
+                Writer.WriteValue(Key, Field.Value.Bool);
+                break;
+            case EGeoJsonType::Number:
+                Writer.WriteValue(Key, Field.Value.Number);
+                break;
+            case EGeoJsonType::String:
+                Writer.WriteValue(Key, Field.Value.String.View());
+                break;
+            case EGeoJsonType::Array:
+                Writer.WriteArrayStart(Key);
+                for (const FGeoJsonValue& Element : Field.Value.Array->Values)
+                {
+                    WriteValue(Writer, Element);
+                }
+                Writer.WriteArrayEnd();
+                break;
+            case EGeoJsonType::Object:
+                Writer.WriteObjectStart(Key);
+                WriteObject(Writer, *Field.Value.Object);
+                Writer.WriteObjectEnd();
+                break;
+            default:
+                Writer.WriteNull(Key);
+                break;
+            }
+        }
+    }
+
+    template <class PrintPolicy>
+    void WriteValue(TJsonWriter<TCHAR, PrintPolicy>& Writer, const FGeoJsonValue& Value)
+    {
+        switch (Value.Type)
+        {
+        case EGeoJsonType::Bool:
+            Writer.WriteValue(Value.Bool);
+            break;
+        case EGeoJsonType::Number:
+            Writer.WriteValue(Value.Number);
+            break;
+        case EGeoJsonType::String:
+            Writer.WriteValue(Value.String.View());
+            break;
+        case EGeoJsonType::Array:
+            Writer.WriteArrayStart();
+            for (const FGeoJsonValue& Element : Value.Array->Values)
+            {
+                WriteValue(Writer, Element);
+            }
+            Writer.WriteArrayEnd();
+            break;
+        case EGeoJsonType::Object:
+            Writer.WriteObjectStart();
+            WriteObject(Writer, *Value.Object);
+            Writer.WriteObjectEnd();
+            break;
+        default:
+            Writer.WriteNull();
+            break;
+        }
+    }
+
+    template <class PrintPolicy>
+    void Serialize(const FGeoJsonValue& Value, FString& OutString)
+    {
+        TSharedRef<TJsonWriter<TCHAR, PrintPolicy>> Writer = TJsonWriterFactory<TCHAR, PrintPolicy>::Create(&OutString);
+        WriteValue(*Writer, Value);
+        Writer->Close();
+    }
+}
+
+void FGeoJsonObject::Serialize(FString& OutString, bool bPrettyPrint) const
+{
+    const FGeoJsonValue Value = FGeoJsonValue::MakeObject(const_cast<FGeoJsonObject*>(this));
+    if (bPrettyPrint)
+    {
+        GeoJsonDom::Serialize<TPrettyJsonPrintPolicy<TCHAR>>(Value, OutString);
+    }
+    else
+    {
+        GeoJsonDom::Serialize<TCondensedJsonPrintPolicy<TCHAR>>(Value, OutString);
+    }
+}
+
+void FGeoJsonArray::Serialize(FString& OutString, bool bPrettyPrint) const
+{
+    const FGeoJsonValue Value = FGeoJsonValue::MakeArray(const_cast<FGeoJsonArray*>(this));
+    if (bPrettyPrint)
+    {
+        GeoJsonDom::Serialize<TPrettyJsonPrintPolicy<TCHAR>>(Value, OutString);
+    }
+    else
+    {
+        GeoJsonDom::Serialize<TCondensedJsonPrintPolicy<TCHAR>>(Value, OutString);
+    }
+}
+
+void FGeoJsonObject::SerializeUtf8(TArray<uint8>& OutBytes, bool bPrettyPrint) const
+{
+    FGeoJsonUtf8Writer Writer(OutBytes, bPrettyPrint);
+    Writer.WriteRootValue(FGeoJsonValue::MakeObject(const_cast<FGeoJsonObject*>(this)));
+}
+
+void FGeoJsonArray::SerializeUtf8(TArray<uint8>& OutBytes, bool bPrettyPrint) const
+{
+    FGeoJsonUtf8Writer Writer(OutBytes, bPrettyPrint);
+    Writer.WriteRootValue(FGeoJsonValue::MakeArray(const_cast<FGeoJsonArray*>(this)));
+}
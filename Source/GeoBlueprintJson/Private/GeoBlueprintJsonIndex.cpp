@@ -0,0 +1,273 @@
+#include "GeoBlueprintJsonIndex.h"
+#include "Algo/BinarySearch.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Hash/xxhash.h"
+#include "Misc/FileHelper.h"
+
+static_assert(PLATFORM_LITTLE_ENDIAN, "The export index is written and mapped in little endian byte order");
+
+FString FGeoBlueprintJsonIndexWriter::MakeKey(FStringView AssetPath, FStringView GraphName)
+{
+    FString Key;
+    Key.Reserve(AssetPath.Len() + GraphName.Len() + 1);
+    Key.Append(AssetPath);
+    Key.AppendChar(TEXT('\n'));
+    Key.Append(GraphName);
+    return Key;
+}
+
+uint64 FGeoBlueprintJsonIndexWriter::HashBytes(const void* Data, uint64 Length)
+{
+    return FXxHash64::HashBuffer(Data, Length).Hash;
+}
+
+void FGeoBlueprintJsonIndexWriter::Add(FStringView AssetPath, FStringView GraphName, uint64 Offset, const void* RecordData, uint32 Length)
+{
+    AddEntry(MakeKey(AssetPath, GraphName), HashBytes(RecordData, Length), Offset, Length);
+}
+
+void FGeoBlueprintJsonIndexWriter::AddEntry(const FString& Key, uint64 ContentHash, uint64 Offset, uint32 Length)
+{
+    FTCHARToUTF8 Utf8Key(*Key, Key.Len());
+
+    FGeoBlueprintJsonIndexEntry& Entry = Entries.AddDefaulted_GetRef();
+    Entry.KeyHash = HashBytes(Utf8Key.Get(), Utf8Key.Length());
+    Entry.ContentHash = ContentHash;
+    Entry.Offset = Offset;
+    Entry.Length = Length;
+    Entry.KeyOffset = StringPool.Num();
+    Entry.KeyLength = Utf8Key.Length();
+    StringPool.Append(reinterpret_cast<const uint8*>(Utf8Key.Get()), Utf8Key.Length());
+}
+
+bool FGeoBlueprintJsonIndexWriter::Save(const FString& IndexPath)
+{
+    // Colliding key hashes stay adjacent, so a lookup only has to compare keys within one run
+    Entries.Sort([](const FGeoBlueprintJsonIndexEntry& A, const FGeoBlueprintJsonIndexEntry& B)
+    {
+        return A.KeyHash < B.KeyHash;
+    });
+
+    FGeoBlueprintJsonIndexHeader Header;
+    Header.NumEntries = Entries.Num();
+    Header.StringPoolOffset = sizeof(FGeoBlueprintJsonIndexHeader) + sizeof(FGeoBlueprintJsonIndexEntry) * Entries.Num();
+    Header.StringPoolSize = StringPool.Num();
+
+    TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*IndexPath));
+    if (!Writer)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Could not write export index %s"), *IndexPath);
+        return false;
+    }
+
+    Writer->Serialize(&Header, sizeof(Header));
+    Writer->Serialize(Entries.GetData(), sizeof(FGeoBlueprintJsonIndexEntry) * Entries.Num());
+    Writer->Serialize(StringPool.GetData(), StringPool.Num());
+    return Writer->Close();
+}
+
+FGeoBlueprintJsonIndexReader::FGeoBlueprintJsonIndexReader()
+{
+}
+
+FGeoBlueprintJsonIndexReader::~FGeoBlueprintJsonIndexReader()
+{
+    Close();
+}
+
+bool FGeoBlueprintJsonIndexReader::Open(const FString& JsonLinesPath, const FString& IndexPath)
+{
+    Close();
+
+    if (!MapOrLoadIndex(IndexPath.IsEmpty() ? GetIndexPath(JsonLinesPath) : IndexPath))
+    {
+        Close();
+        return false;
+    }
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    DataHandle.Reset(PlatformFile.OpenMapped(*JsonLinesPath));
+    if (DataHandle && DataHandle->GetFileSize() > 0)
+    {
+        DataRegion.Reset(DataHandle->MapRegion(0, DataHandle->GetFileSize()));
+    }
+
+    if (DataRegion)
+    {
+        MappedData = DataRegion->GetMappedPtr();
+        DataSize = DataRegion->GetMappedSize();
+    }
+    else
+    {
+        DataFile.Reset(PlatformFile.OpenRead(*JsonLinesPath));
+        if (!DataFile)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Could not open export %s"), *JsonLinesPath);
+            Close();
+            return false;
+        }
+        DataSize = DataFile->Size();
+    }
+    return true;
+}
+
+bool FGeoBlueprintJsonIndexReader::MapOrLoadIndex(const FString& IndexPath)
+{
+    const uint8* IndexBytes = nullptr;
+    uint64 IndexSize = 0;
+
+    IndexHandle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*IndexPath));
+    if (IndexHandle && IndexHandle->GetFileSize() > 0)
+    {
+        IndexRegion.Reset(IndexHandle->MapRegion(0, IndexHandle->GetFileSize()));
+    }
+
+    if (IndexRegion)
+    {
+        IndexBytes = IndexRegion->GetMappedPtr();
+        IndexSize = IndexRegion->GetMappedSize();
+    }
+    else if (FFileHelper::LoadFileToArray(IndexData, *IndexPath, FILEREAD_Silent))
+    {
+        IndexBytes = IndexData.GetData();
+        IndexSize = IndexData.Num();
+    }
+    else
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Could not open export index %s"), *IndexPath);
+        return false;
+    }
+
+    if (IndexSize < sizeof(FGeoBlueprintJsonIndexHeader))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Export index %s is truncated"), *IndexPath);
+        return false;
+    }
+
+    FGeoBlueprintJsonIndexHeader Header;
+    FMemory::Memcpy(&Header, IndexBytes, sizeof(Header));
+    const uint64 EntriesEnd = sizeof(FGeoBlueprintJsonIndexHeader) + static_cast<uint64>(Header.NumEntries) * sizeof(FGeoBlueprintJsonIndexEntry);
+    if (Header.Magic != FGeoBlueprintJsonIndexHeader::ExpectedMagic
+        || Header.Version != FGeoBlueprintJsonIndexHeader::CurrentVersion
+        || Header.StringPoolOffset < EntriesEnd
+        || Header.StringPoolOffset + Header.StringPoolSize > IndexSize)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("%s is not a valid export index"), *IndexPath);
+        return false;
+    }
+
+    Entries = reinterpret_cast<const FGeoBlueprintJsonIndexEntry*>(IndexBytes + sizeof(FGeoBlueprintJsonIndexHeader));
+    NumEntries = Header.NumEntries;
+    StringPool = IndexBytes + Header.StringPoolOffset;
+    StringPoolSize = Header.StringPoolSize;
+    return true;
+}
+
+void FGeoBlueprintJsonIndexReader::Close()
+{
+    Entries = nullptr;
+    NumEntries = 0;
+    StringPool = nullptr;
+    StringPoolSize = 0;
+    MappedData = nullptr;
+    DataSize = 0;
+
+    // Regions have to be unmapped before their file handles close
+    IndexRegion.Reset();
+    IndexHandle.Reset();
+    IndexData.Empty();
+    DataRegion.Reset();
+    DataHandle.Reset();
+    DataFile.Reset();
+}
+
+bool FGeoBlueprintJsonIndexReader::MatchesKey(const FGeoBlueprintJsonIndexEntry& Entry, const uint8* Key, int32 KeyLength) const
+{
+    return Entry.KeyLength == static_cast<uint32>(KeyLength)
+        && static_cast<uint64>(Entry.KeyOffset) + Entry.KeyLength <= StringPoolSize
+        && FMemory::Memcmp(StringPool + Entry.KeyOffset, Key, KeyLength) == 0;
+}
+
+const FGeoBlueprintJsonIndexEntry* FGeoBlueprintJsonIndexReader::Find(FStringView AssetPath, FStringView GraphName) const
+{
+    if (!IsOpen())
+    {
+        return nullptr;
+    }
+
+    const FString Key = FGeoBlueprintJsonIndexWriter::MakeKey(AssetPath, GraphName);
+    FTCHARToUTF8 Utf8Key(*Key, Key.Len());
+    const uint8* KeyBytes = reinterpret_cast<const uint8*>(Utf8Key.Get());
+    const uint64 KeyHash = FGeoBlueprintJsonIndexWriter::HashBytes(KeyBytes, Utf8Key.Length());
+
+    const TConstArrayView<FGeoBlueprintJsonIndexEntry> EntryView = GetEntries();
+    for (int32 Index = Algo::LowerBoundBy(EntryView, KeyHash, &FGeoBlueprintJsonIndexEntry::KeyHash); Index < NumEntries && Entries[Index].KeyHash == KeyHash; ++Index)
+    {
+        if (MatchesKey(Entries[Index], KeyBytes, Utf8Key.Length()))
+        {
+            return &Entries[Index];
+        }
+    }
+    return nullptr;
+}
+
+TConstArrayView<uint8> FGeoBlueprintJsonIndexReader::GetRecordView(const FGeoBlueprintJsonIndexEntry& Entry) const
+{
+    if (!MappedData || Entry.Offset + Entry.Length > DataSize)
+    {
+        return TConstArrayView<uint8>();
+    }
+    return TConstArrayView<uint8>(MappedData + Entry.Offset, Entry.Length);
+}
+
+bool FGeoBlueprintJsonIndexReader::ReadRecord(const FGeoBlueprintJsonIndexEntry& Entry, FString& OutJson) const
+{
+    if (Entry.Offset + Entry.Length > DataSize)
+    {
+        return false;
+    }
+
+    TArray<uint8> Buffer;
+    TConstArrayView<uint8> Record = GetRecordView(Entry);
+    if (Record.Num() == 0 && Entry.Length > 0)
+    {
+        if (!DataFile || !DataFile->Seek(static_cast<int64>(Entry.Offset)))
+        {
+            return false;
+        }
+        Buffer.SetNumUninitialized(Entry.Length);
+        if (!DataFile->Read(Buffer.GetData(), Entry.Length))
+        {
+            return false;
+        }
+        Record = Buffer;
+    }
+
+    FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Record.GetData()), Record.Num());
+    OutJson = FString(Converted.Length(), Converted.Get());
+    return true;
+}
+
+bool FGeoBlueprintJsonIndexReader::ReadRecord(FStringView AssetPath, FStringView GraphName, FString& OutJson) const
+{
+    const FGeoBlueprintJsonIndexEntry* Entry = Find(AssetPath, GraphName);
+    return Entry && ReadRecord(*Entry, OutJson);
+}
+
+TConstArrayView<FGeoBlueprintJsonIndexEntry> FGeoBlueprintJsonIndexReader::GetEntries() const
+{
+    return TConstArrayView<FGeoBlueprintJsonIndexEntry>(Entries, NumEntries);
+}
+
+FString FGeoBlueprintJsonIndexReader::GetKey(const FGeoBlueprintJsonIndexEntry& Entry) const
+{
+    if (static_cast<uint64>(Entry.KeyOffset) + Entry.KeyLength > StringPoolSize)
+    {
+        return FString();
+    }
+
+    FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(StringPool + Entry.KeyOffset), Entry.KeyLength);
+    return FString(Converted.Length(), Converted.Get());
+}
@@ -1,14 +1,33 @@
 #include "GeoBlueprintJsonModule.h"
+#include "GeoBlueprintJsonScriptProfiler.h"
+#include "Misc/CommandLine.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/Parse.h"
 #include "Modules/ModuleManager.h"
 
 #define LOCTEXT_NAMESPACE "FGeoBlueprintJsonModule"
 
 void FGeoBlueprintJsonModule::StartupModule()
 {
+    // -GeoBlueprintProfile=<File> captures Blueprint execution for the whole session and writes it on exit,
+    // which lets headless soak tests produce heat data without any console interaction
+    if (FParse::Value(FCommandLine::Get(), TEXT("GeoBlueprintProfile="), ProfileOutputFile) && !ProfileOutputFile.IsEmpty())
+    {
+        FGeoBlueprintJsonScriptProfiler::Get().Start();
+        PreExitHandle = FCoreDelegates::OnPreExit.AddRaw(this, &FGeoBlueprintJsonModule::WriteSessionProfile);
+    }
 }
 
 void FGeoBlueprintJsonModule::ShutdownModule()
 {
+    FCoreDelegates::OnPreExit.Remove(PreExitHandle);
+    FGeoBlueprintJsonScriptProfiler::Get().Stop();
+}
+
+void FGeoBlueprintJsonModule::WriteSessionProfile()
+{
+    FGeoBlueprintJsonScriptProfiler::Get().Stop();
+    FGeoBlueprintJsonScriptProfiler::Get().DumpToFile(ProfileOutputFile);
 }
 
 #undef LOCTEXT_NAMESPACE
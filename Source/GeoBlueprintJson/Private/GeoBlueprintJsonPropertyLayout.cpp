@@ -0,0 +1,118 @@
+#include "GeoBlueprintJsonPropertyLayout.h"
+#include "UObject/Class.h"
+#include "UObject/UnrealType.h"
+
+FGeoBlueprintJsonClassLayout::FGeoBlueprintJsonClassLayout(const UClass* InClass)
+    : Class(InClass)
+    , ClassPath(InClass->GetPathName())
+{
+    for (TFieldIterator<FProperty> It(InClass); It; ++It)
+    {
+        EGeoJsonPropertyKind Kind;
+        if (!GetPropertyKind(*It, Kind))
+        {
+            continue;
+        }
+
+        FieldIndexByName.Add(It->GetFName(), Fields.Num());
+        FGeoBlueprintJsonPropertyField& Field = Fields.AddDefaulted_GetRef();
+        Field.Property = *It;
+        Field.Name = It->GetName();
+        Field.Kind = Kind;
+    }
+}
+
+int32 FGeoBlueprintJsonClassLayout::FindFieldIndex(FName PropertyName) const
+{
+    const int32* Index = FieldIndexByName.Find(PropertyName);
+    return Index ? *Index : INDEX_NONE;
+}
+
+bool FGeoBlueprintJsonClassLayout::GetPropertyKind(const FProperty* Property, EGeoJsonPropertyKind& OutKind)
+{
+    if (Property->IsA(FStrProperty::StaticClass()))
+    {
+        OutKind = EGeoJsonPropertyKind::String;
+    }
+    else if (Property->IsA(FIntProperty::StaticClass()))
+    {
+        OutKind = EGeoJsonPropertyKind::Int;
+    }
+    else if (Property->IsA(FFloatProperty::StaticClass()))
+    {
+        OutKind = EGeoJsonPropertyKind::Float;
+    }
+    else if (Property->IsA(FBoolProperty::StaticClass()))
+    {
+        OutKind = EGeoJsonPropertyKind::Bool;
+    }
+    else if (Property->IsA(FObjectProperty::StaticClass()))
+    {
+        OutKind = EGeoJsonPropertyKind::Object;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+const FGeoBlueprintJsonClassLayout& FGeoBlueprintJsonClassLayoutCache::Get(const UClass* Class)
+{
+    TUniquePtr<FGeoBlueprintJsonClassLayout>& Layout = Layouts.FindOrAdd(Class);
+    if (!Layout)
+    {
+        Layout = MakeUnique<FGeoBlueprintJsonClassLayout>(Class);
+    }
+    return *Layout;
+}
+
+namespace GeoBlueprintJsonPropertyDelta
+{
+    bool BaselineHasProperty(const UObject* Baseline, const FProperty* Property)
+    {
+        return Baseline->GetClass()->IsChildOf(Property->GetOwnerClass());
+    }
+
+    UObject* GetOwnedSubobject(const FObjectProperty* Property, const UObject* Object)
+    {
+        UObject* Value = Property->GetObjectPropertyValue_InContainer(Object);
+        return Value && Value->GetOuter() == Object ? Value : nullptr;
+    }
+
+    void ResetToArchetype(UObject* Object)
+    {
+        const UObject* Archetype = Object->GetArchetype();
+        if (!Archetype)
+        {
+            return;
+        }
+
+        const FGeoBlueprintJsonClassLayout Layout(Object->GetClass());
+        for (const FGeoBlueprintJsonPropertyField& Field : Layout.GetFields())
+        {
+            if (!BaselineHasProperty(Archetype, Field.Property))
+            {
+                continue;
+            }
+
+            if (Field.Kind == EGeoJsonPropertyKind::Object)
+            {
+                const FObjectProperty* ObjectProperty = CastFieldChecked<FObjectProperty>(Field.Property);
+                if (UObject* Subobject = GetOwnedSubobject(ObjectProperty, Object))
+                {
+                    ResetToArchetype(Subobject);
+                    continue;
+                }
+
+                // Instanced values belong to their owner, so the archetype's own subobject is never shared
+                if (ObjectProperty->HasAnyPropertyFlags(CPF_InstancedReference | CPF_PersistentInstance) || GetOwnedSubobject(ObjectProperty, Archetype))
+                {
+                    continue;
+                }
+            }
+
+            Field.Property->CopyCompleteValue_InContainer(Object, Archetype);
+        }
+    }
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FObjectProperty;
+class FProperty;
+class UClass;
+class UObject;
+
+/** Property types the object <-> JSON conversion understands */
+enum class EGeoJsonPropertyKind : uint8
+{
+    String,
+    Int,
+    Float,
+    Bool,
+    Object
+};
+
+struct FGeoBlueprintJsonPropertyField
+{
+    FProperty* Property = nullptr;
+    FString Name;
+    EGeoJsonPropertyKind Kind = EGeoJsonPropertyKind::String;
+};
+
+/**
+ * The supported properties of one class, resolved once so that exporting many objects of the same
+ * class doesn't walk the reflection data for every object
+ */
+class FGeoBlueprintJsonClassLayout
+{
+public:
+    explicit FGeoBlueprintJsonClassLayout(const UClass* InClass);
+
+    const UClass* GetClass() const { return Class; }
+    const FString& GetClassPath() const { return ClassPath; }
+    const TArray<FGeoBlueprintJsonPropertyField>& GetFields() const { return Fields; }
+
+    /** Index into GetFields() of the property with the given name, or INDEX_NONE */
+    int32 FindFieldIndex(FName PropertyName) const;
+
+    static bool GetPropertyKind(const FProperty* Property, EGeoJsonPropertyKind& OutKind);
+
+private:
+    const UClass* Class;
+    FString ClassPath;
+    TArray<FGeoBlueprintJsonPropertyField> Fields;
+    TMap<FName, int32> FieldIndexByName;
+};
+
+/**
+ * Layouts for every class seen during one operation. Classes can be recompiled between operations,
+ * so the cache lives no longer than the operation that builds it. Game thread only.
+ */
+class FGeoBlueprintJsonClassLayoutCache
+{
+public:
+    const FGeoBlueprintJsonClassLayout& Get(const UClass* Class);
+
+private:
+    TMap<const UClass*, TUniquePtr<FGeoBlueprintJsonClassLayout>> Layouts;
+};
+
+namespace GeoBlueprintJsonPropertyDelta
+{
+    /** Whether Baseline has the property at all; a subclass instance can be compared against a parent's defaults */
+    bool BaselineHasProperty(const UObject* Baseline, const FProperty* Property);
+
+    /** Object properties pointing at subobjects the object owns, such as default subobjects and instanced properties */
+    UObject* GetOwnedSubobject(const FObjectProperty* Property, const UObject* Object);
+
+    /**
+     * Copies every supported property back from the archetype, plain object references included. Owned
+     * subobjects are reset in place rather than repointed, and other instanced references are left alone.
+     */
+    void ResetToArchetype(UObject* Object);
+}
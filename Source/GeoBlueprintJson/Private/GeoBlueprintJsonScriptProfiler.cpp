@@ -0,0 +1,484 @@
+#include "GeoBlueprintJsonScriptProfiler.h"
+#include "GeoBlueprintJsonDom.h"
+#include "Dom/JsonObject.h"
+#include "EdGraph/EdGraphNode.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/Script.h"
+#include "UObject/Stack.h"
+
+namespace GeoBlueprintJsonScriptProfiler
+{
+    static FAutoConsoleCommand StartCommand(
+        TEXT("GeoBlueprintJson.Profile.Start"),
+        TEXT("Starts capturing Blueprint execution counts and times"),
+        FConsoleCommandDelegate::CreateLambda([]()
+        {
+            FGeoBlueprintJsonScriptProfiler::Get().Start();
+        }));
+
+    static FAutoConsoleCommand StopCommand(
+        TEXT("GeoBlueprintJson.Profile.Stop"),
+        TEXT("Stops the Blueprint execution capture"),
+        FConsoleCommandDelegate::CreateLambda([]()
+        {
+            FGeoBlueprintJsonScriptProfiler::Get().Stop();
+        }));
+
+    static FAutoConsoleCommand ResetCommand(
+        TEXT("GeoBlueprintJson.Profile.Reset"),
+        TEXT("Discards everything captured so far"),
+        FConsoleCommandDelegate::CreateLambda([]()
+        {
+            FGeoBlueprintJsonScriptProfiler::Get().Reset();
+        }));
+
+    static FAutoConsoleCommand DumpCommand(
+        TEXT("GeoBlueprintJson.Profile.Dump"),
+        TEXT("Writes the Blueprint execution capture to the given JSON file"),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            if (Args.Num() == 0)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("Usage: GeoBlueprintJson.Profile.Dump <File>"));
+                return;
+            }
+            FGeoBlueprintJsonScriptProfiler::Get().DumpToFile(Args[0]);
+        }));
+
+    static FString GetOwningBlueprintPath(const UFunction* Function)
+    {
+        const UClass* OwnerClass = Function->GetOwnerClass();
+#if WITH_EDITORONLY_DATA
+        if (const UBlueprintGeneratedClass* GeneratedClass = Cast<UBlueprintGeneratedClass>(OwnerClass))
+        {
+            if (GeneratedClass->ClassGeneratedBy)
+            {
+                return GeneratedClass->ClassGeneratedBy->GetPathName();
+            }
+        }
+#endif
+        return OwnerClass ? OwnerClass->GetPathName() : FString();
+    }
+}
+
+FGeoBlueprintJsonScriptProfiler& FGeoBlueprintJsonScriptProfiler::Get()
+{
+    static FGeoBlueprintJsonScriptProfiler Profiler;
+    return Profiler;
+}
+
+void FGeoBlueprintJsonScriptProfiler::Start()
+{
+    if (bRunning)
+    {
+        return;
+    }
+
+#if DO_BLUEPRINT_GUARD
+    EnterContextHandle = FBlueprintContextTracker::OnEnterScriptContext.AddRaw(this, &FGeoBlueprintJsonScriptProfiler::OnEnterScriptContext);
+    ExitContextHandle = FBlueprintContextTracker::OnExitScriptContext.AddRaw(this, &FGeoBlueprintJsonScriptProfiler::OnExitScriptContext);
+#else
+    UE_LOG(LogTemp, Warning, TEXT("Blueprint function timing needs DO_BLUEPRINT_GUARD; only node hits will be captured in this build"));
+#endif
+    ScriptExceptionHandle = FBlueprintCoreDelegates::OnScriptException.AddRaw(this, &FGeoBlueprintJsonScriptProfiler::OnScriptException);
+    ProfilingEventHandle = FBlueprintCoreDelegates::OnScriptProfilingEvent.AddRaw(this, &FGeoBlueprintJsonScriptProfiler::OnScriptProfilingEvent);
+
+    ContextStack.Reset();
+    CaptureStartTime = FPlatformTime::Seconds();
+    bRunning = true;
+    UE_LOG(LogTemp, Log, TEXT("Blueprint execution capture started"));
+}
+
+void FGeoBlueprintJsonScriptProfiler::Stop()
+{
+    if (!bRunning)
+    {
+        return;
+    }
+
+#if DO_BLUEPRINT_GUARD
+    FBlueprintContextTracker::OnEnterScriptContext.Remove(EnterContextHandle);
+    FBlueprintContextTracker::OnExitScriptContext.Remove(ExitContextHandle);
+#endif
+    FBlueprintCoreDelegates::OnScriptException.Remove(ScriptExceptionHandle);
+    FBlueprintCoreDelegates::OnScriptProfilingEvent.Remove(ProfilingEventHandle);
+
+    // Frames still open when the capture stops are discarded rather than timed up to now
+    ContextStack.Reset();
+    CapturedSeconds += FPlatformTime::Seconds() - CaptureStartTime;
+    bRunning = false;
+    UE_LOG(LogTemp, Log, TEXT("Blueprint execution capture stopped after %.1fs"), CapturedSeconds);
+}
+
+void FGeoBlueprintJsonScriptProfiler::Reset()
+{
+    FunctionStats.Reset();
+    NodeStats.Reset();
+    ContextStack.Reset();
+    CaptureStartTime = FPlatformTime::Seconds();
+    CapturedSeconds = 0.0;
+    bReceivedInstrumentation = false;
+    ++CaptureVersion;
+}
+
+void FGeoBlueprintJsonScriptProfiler::OnEnterScriptContext(const FBlueprintContextTracker& Tracker, const UObject* ContextObject, const UFunction* Function)
+{
+    if (!IsInGameThread() || !Function)
+    {
+        return;
+    }
+
+    FContextFrame& Frame = ContextStack.AddDefaulted_GetRef();
+    Frame.Function = const_cast<UFunction*>(Function);
+    Frame.StartTime = FPlatformTime::Seconds();
+}
+
+void FGeoBlueprintJsonScriptProfiler::OnExitScriptContext(const FBlueprintContextTracker& Tracker)
+{
+    // An empty stack means the context was entered before the capture started
+    if (!IsInGameThread() || ContextStack.Num() == 0)
+    {
+        return;
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    FContextFrame Frame = ContextStack.Pop(EAllowShrinking::No);
+    CloseCurrentNode(Frame, Now);
+
+    FExecutionStats& Stats = FunctionStats.FindOrAdd(Frame.Function);
+    ++Stats.Count;
+    Stats.Seconds += Now - Frame.StartTime;
+    ++CaptureVersion;
+}
+
+void FGeoBlueprintJsonScriptProfiler::OnScriptException(const UObject* ActiveObject, const FFrame& StackFrame, const FBlueprintExceptionInfo& Info)
+{
+    // Debug tracepoints mark every impure node in editor-compiled bytecode. They are only a
+    // fallback: instrumented bytecode reports the same nodes through OnScriptProfilingEvent.
+    if (bReceivedInstrumentation || Info.GetType() != EBlueprintExceptionType::Tracepoint)
+    {
+        return;
+    }
+
+    if (!IsInGameThread() || !StackFrame.Node || !StackFrame.Code)
+    {
+        return;
+    }
+
+    // The tracepoint opcode has already been consumed when the exception is raised
+    const int32 CodeOffset = UE_PTRDIFF_TO_INT32(StackFrame.Code - StackFrame.Node->Script.GetData()) - 1;
+    RecordNodeSite(StackFrame.Node, CodeOffset);
+}
+
+void FGeoBlueprintJsonScriptProfiler::OnScriptProfilingEvent(const FScriptInstrumentationSignal& Signal)
+{
+    const EScriptInstrumentation::Type Type = Signal.GetType();
+    if (Type != EScriptInstrumentation::NodeEntry && Type != EScriptInstrumentation::PureNodeEntry)
+    {
+        return;
+    }
+
+    if (!IsInGameThread() || !Signal.IsStackFrameValid())
+    {
+        return;
+    }
+
+    bReceivedInstrumentation = true;
+    RecordNodeSite(Signal.GetStackFrame().Node, Signal.GetScriptCodeOffset());
+}
+
+void FGeoBlueprintJsonScriptProfiler::RecordNodeSite(UFunction* Function, int32 CodeOffset)
+{
+    FNodeKey Key;
+    Key.Function = Function;
+    Key.CodeOffset = CodeOffset;
+    ++NodeStats.FindOrAdd(Key).Count;
+    ++CaptureVersion;
+
+    // Time runs from one node site to the next in the same script context, so a node's time
+    // includes any functions it calls
+    if (ContextStack.Num() > 0)
+    {
+        const double Now = FPlatformTime::Seconds();
+        FContextFrame& Frame = ContextStack.Last();
+        CloseCurrentNode(Frame, Now);
+        Frame.CurrentNode = Key;
+        Frame.NodeStartTime = Now;
+        Frame.bHasNode = true;
+    }
+}
+
+void FGeoBlueprintJsonScriptProfiler::CloseCurrentNode(FContextFrame& Frame, double Now)
+{
+    if (!Frame.bHasNode)
+    {
+        return;
+    }
+
+    if (FExecutionStats* Stats = NodeStats.Find(Frame.CurrentNode))
+    {
+        Stats->Seconds += Now - Frame.NodeStartTime;
+    }
+    Frame.bHasNode = false;
+}
+
+FString FGeoBlueprintJsonScriptProfiler::MakeHeatKey(const FString& BlueprintPath, const FString& Name)
+{
+    return BlueprintPath + TEXT(":") + Name;
+}
+
+void FGeoBlueprintJsonScriptProfiler::ResolveFunctions(TArray<FResolvedStats>& OutFunctions) const
+{
+    OutFunctions.Reset();
+    for (const TPair<TWeakObjectPtr<UFunction>, FExecutionStats>& Pair : FunctionStats)
+    {
+        const UFunction* Function = Pair.Key.Get();
+        if (!Function)
+        {
+            continue;
+        }
+
+        FResolvedStats& Entry = OutFunctions.AddDefaulted_GetRef();
+        Entry.BlueprintPath = GeoBlueprintJsonScriptProfiler::GetOwningBlueprintPath(Function);
+        Entry.Name = Function->GetName();
+        Entry.Stats = Pair.Value;
+    }
+
+    OutFunctions.Sort([](const FResolvedStats& A, const FResolvedStats& B)
+    {
+        return A.Stats.Seconds > B.Stats.Seconds;
+    });
+}
+
+void FGeoBlueprintJsonScriptProfiler::ResolveNodes(TArray<FResolvedStats>& OutNodes) const
+{
+    OutNodes.Reset();
+
+    // A node owns several code offsets when it has more than one debug site, so offsets are merged per node
+    TMap<FString, int32> IndexByKey;
+    for (const TPair<FNodeKey, FExecutionStats>& Pair : NodeStats)
+    {
+        UFunction* Function = Pair.Key.Function.Get();
+        if (!Function)
+        {
+            continue;
+        }
+
+        const FString BlueprintPath = GeoBlueprintJsonScriptProfiler::GetOwningBlueprintPath(Function);
+        FString Name = FString::Printf(TEXT("%s@%d"), *Function->GetName(), Pair.Key.CodeOffset);
+#if WITH_EDITORONLY_DATA
+        if (UBlueprintGeneratedClass* GeneratedClass = Cast<UBlueprintGeneratedClass>(Function->GetOwnerClass()))
+        {
+            if (const UEdGraphNode* Node = GeneratedClass->GetDebugData().FindSourceNodeFromCodeLocation(Function, Pair.Key.CodeOffset, true))
+            {
+                Name = Node->NodeGuid.ToString();
+            }
+        }
+#endif
+
+        const FString Key = MakeHeatKey(BlueprintPath, Name);
+        if (const int32* ExistingIndex = IndexByKey.Find(Key))
+        {
+            // Every debug site of a node fires once per execution, so only time accumulates
+            FResolvedStats& Existing = OutNodes[*ExistingIndex];
+            Existing.Stats.Count = FMath::Max(Existing.Stats.Count, Pair.Value.Count);
+            Existing.Stats.Seconds += Pair.Value.Seconds;
+            continue;
+        }
+
+        IndexByKey.Add(Key, OutNodes.Num());
+        FResolvedStats& Entry = OutNodes.AddDefaulted_GetRef();
+        Entry.BlueprintPath = BlueprintPath;
+        Entry.Name = MoveTemp(Name);
+        Entry.Stats = Pair.Value;
+    }
+
+    OutNodes.Sort([](const FResolvedStats& A, const FResolvedStats& B)
+    {
+        return A.Stats.Seconds > B.Stats.Seconds;
+    });
+}
+
+FString FGeoBlueprintJsonScriptProfiler::DumpToJson() const
+{
+    const double ElapsedSeconds = CapturedSeconds + (bRunning ? FPlatformTime::Seconds() - CaptureStartTime : 0.0);
+
+    TArray<FResolvedStats> Functions;
+    TArray<FResolvedStats> Nodes;
+    ResolveFunctions(Functions);
+    ResolveNodes(Nodes);
+
+    FGeoJsonArena Arena;
+    FGeoJsonObject RootObject(Arena);
+    RootObject.SetNumberField(TEXT("CaptureSeconds"), ElapsedSeconds);
+
+    FGeoJsonArray* FunctionsArray = RootObject.SetArrayField(TEXT("Functions"));
+    for (const FResolvedStats& Entry : Functions)
+    {
+        FGeoJsonObject* FunctionObject = FunctionsArray->AddObject();
+        FunctionObject->SetStringField(TEXT("Blueprint"), Entry.BlueprintPath);
+        FunctionObject->SetStringField(TEXT("Function"), Entry.Name);
+        FunctionObject->SetNumberField(TEXT("HitCount"), static_cast<double>(Entry.Stats.Count));
+        FunctionObject->SetNumberField(TEXT("TimeMs"), Entry.Stats.Seconds * 1000.0);
+    }
+
+    FGeoJsonArray* NodesArray = RootObject.SetArrayField(TEXT("Nodes"));
+    for (const FResolvedStats& Entry : Nodes)
+    {
+        FGeoJsonObject* NodeObject = NodesArray->AddObject();
+        NodeObject->SetStringField(TEXT("Blueprint"), Entry.BlueprintPath);
+        NodeObject->SetStringField(TEXT("NodeGuid"), Entry.Name);
+        NodeObject->SetNumberField(TEXT("HitCount"), static_cast<double>(Entry.Stats.Count));
+        NodeObject->SetNumberField(TEXT("TimeMs"), Entry.Stats.Seconds * 1000.0);
+    }
+
+    FString OutputString;
+    RootObject.Serialize(OutputString);
+    return OutputString;
+}
+
+bool FGeoBlueprintJsonScriptProfiler::DumpToFile(const FString& FilePath) const
+{
+    const bool bSaved = FFileHelper::SaveStringToFile(DumpToJson(), *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+    if (bSaved)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Blueprint execution capture written to %s"), *FilePath);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Error, TEXT("Could not write Blueprint execution capture to %s"), *FilePath);
+    }
+    return bSaved;
+}
+
+void FGeoBlueprintJsonScriptProfiler::BuildHeatMap(FGeoBlueprintJsonHeatMap& OutHeatMap) const
+{
+    OutHeatMap.Reset();
+
+    TArray<FResolvedStats> Entries;
+    ResolveFunctions(Entries);
+    TArray<FResolvedStats> Nodes;
+    ResolveNodes(Nodes);
+    Entries.Append(MoveTemp(Nodes));
+
+    for (const FResolvedStats& Entry : Entries)
+    {
+        FGeoBlueprintJsonHeat& Heat = OutHeatMap.Add(MakeHeatKey(Entry.BlueprintPath, Entry.Name));
+        Heat.HitCount = Entry.Stats.Count;
+        Heat.TimeMs = Entry.Stats.Seconds * 1000.0;
+    }
+}
+
+TSharedRef<const FGeoBlueprintJsonHeatMap> FGeoBlueprintJsonScriptProfiler::GetHeatMap()
+{
+    check(IsInGameThread());
+
+    const double Now = FPlatformTime::Seconds();
+    const bool bChanged = !CachedHeatMap.IsValid() || CachedHeatMapVersion != CaptureVersion;
+    if (bChanged && (!CachedHeatMap.IsValid() || !bRunning || Now - CachedHeatMapTime >= HeatMapRefreshSeconds))
+    {
+        TSharedRef<FGeoBlueprintJsonHeatMap> HeatMap = MakeShared<FGeoBlueprintJsonHeatMap>();
+        if (HasSamples())
+        {
+            BuildHeatMap(*HeatMap);
+        }
+        CachedHeatMap = HeatMap;
+        CachedHeatMapVersion = CaptureVersion;
+        CachedHeatMapTime = Now;
+    }
+    return CachedHeatMap.ToSharedRef();
+}
+
+TSharedRef<const FGeoBlueprintJsonHeatMap> FGeoBlueprintJsonScriptProfiler::GetFileHeatMap(const FString& FilePath)
+{
+    check(IsInGameThread());
+
+    struct FCachedFile
+    {
+        FDateTime TimeStamp;
+        TSharedRef<const FGeoBlueprintJsonHeatMap> HeatMap;
+    };
+    static TMap<FString, FCachedFile> CachedFiles;
+
+    const FDateTime TimeStamp = IFileManager::Get().GetTimeStamp(*FilePath);
+    if (const FCachedFile* Cached = CachedFiles.Find(FilePath); Cached && Cached->TimeStamp == TimeStamp)
+    {
+        return Cached->HeatMap;
+    }
+
+    TSharedRef<FGeoBlueprintJsonHeatMap> HeatMap = MakeShared<FGeoBlueprintJsonHeatMap>();
+    LoadHeatMap(FilePath, *HeatMap);
+    CachedFiles.Add(FilePath, FCachedFile{ TimeStamp, HeatMap });
+    return HeatMap;
+}
+
+bool FGeoBlueprintJsonScriptProfiler::LoadHeatMap(const FString& FilePath, FGeoBlueprintJsonHeatMap& OutHeatMap)
+{
+    OutHeatMap.Reset();
+
+    FString JsonString;
+    if (!FFileHelper::LoadFileToString(JsonString, *FilePath))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Could not read Blueprint execution capture %s"), *FilePath);
+        return false;
+    }
+
+    TSharedPtr<FJsonObject> RootObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+    if (!FJsonSerializer::Deserialize(Reader, RootObject) || !RootObject.IsValid())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Blueprint execution capture %s is not valid JSON"), *FilePath);
+        return false;
+    }
+
+    auto AddEntries = [&OutHeatMap, &RootObject](const TCHAR* ArrayField, const TCHAR* NameField)
+    {
+        const TArray<TSharedPtr<FJsonValue>>* Entries = nullptr;
+        if (!RootObject->TryGetArrayField(ArrayField, Entries))
+        {
+            return;
+        }
+
+        for (const TSharedPtr<FJsonValue>& EntryValue : *Entries)
+        {
+            const TSharedPtr<FJsonObject>* EntryObject = nullptr;
+            if (!EntryValue.IsValid() || !EntryValue->TryGetObject(EntryObject))
+            {
+                continue;
+            }
+
+            FGeoBlueprintJsonHeat& Heat = OutHeatMap.Add(MakeHeatKey((*EntryObject)->GetStringField(TEXT("Blueprint")), (*EntryObject)->GetStringField(NameField)));
+            Heat.HitCount = static_cast<int64>((*EntryObject)->GetNumberField(TEXT("HitCount")));
+            Heat.TimeMs = (*EntryObject)->GetNumberField(TEXT("TimeMs"));
+        }
+    };
+
+    AddEntries(TEXT("Functions"), TEXT("Function"));
+    AddEntries(TEXT("Nodes"), TEXT("NodeGuid"));
+    return true;
+}
+
+void UGeoBlueprintJsonScriptProfilerLibrary::StartBlueprintProfiling()
+{
+    FGeoBlueprintJsonScriptProfiler::Get().Start();
+}
+
+void UGeoBlueprintJsonScriptProfilerLibrary::StopBlueprintProfiling()
+{
+    FGeoBlueprintJsonScriptProfiler::Get().Stop();
+}
+
+void UGeoBlueprintJsonScriptProfilerLibrary::ResetBlueprintProfiling()
+{
+    FGeoBlueprintJsonScriptProfiler::Get().Reset();
+}
+
+bool UGeoBlueprintJsonScriptProfilerLibrary::DumpBlueprintProfile(const FString& FilePath)
+{
+    return FGeoBlueprintJsonScriptProfiler::Get().DumpToFile(FilePath);
+}
@@ -1,5 +1,16 @@
 #include "GeoBlueprintJsonSemanticTags.h"
 
+namespace GeoBlueprintJsonSemanticTags
+{
+    /** Graph exports write Components and Interfaces as JSON arrays, so a stringified empty array counts as empty */
+    static bool IsEmptyList(const FString& Value)
+    {
+        FString Trimmed = Value.TrimStartAndEnd();
+        Trimmed.ReplaceInline(TEXT(" "), TEXT(""));
+        return Trimmed.IsEmpty() || Trimmed == TEXT("[]");
+    }
+}
+
 TArray<EBlueprintJsonSemanticTag> UGeoBlueprintJsonSemanticTags::GetNodeSemanticTags(const FString& NodeType, const TMap<FString, FString>& NodeProperties)
 {
     TArray<EBlueprintJsonSemanticTag> Tags;
@@ -185,7 +196,7 @@ TArray<EBlueprintJsonSemanticTag> UGeoBlueprintJsonSemanticTags::GetBlueprintSem
 
     if (const FString* Interfaces = BlueprintProperties.Find(TEXT("Interfaces")))
     {
-        if (!Interfaces->IsEmpty())
+        if (!GeoBlueprintJsonSemanticTags::IsEmptyList(*Interfaces))
         {
             Tags.Add(EBlueprintJsonSemanticTag::HasInterfaces);
         }
@@ -193,7 +204,7 @@ TArray<EBlueprintJsonSemanticTag> UGeoBlueprintJsonSemanticTags::GetBlueprintSem
 
     if (const FString* Components = BlueprintProperties.Find(TEXT("Components")))
     {
-        if (!Components->IsEmpty())
+        if (!GeoBlueprintJsonSemanticTags::IsEmptyList(*Components))
         {
             Tags.Add(EBlueprintJsonSemanticTag::HasComponents);
         }
@@ -0,0 +1,262 @@
+#include "GeoBlueprintJsonStreamingReader.h"
+#include "GeoBlueprintJsonPropertyLayout.h"
+#include "HAL/FileManager.h"
+#include "Serialization/JsonReader.h"
+#include "UObject/UnrealType.h"
+
+namespace GeoBlueprintJsonStreamingReader
+{
+    template <typename CharType>
+    class TApplier
+    {
+    public:
+        TApplier(TJsonReader<CharType>& InReader, FGeoBlueprintJsonClassLayoutCache& InLayouts)
+            : Reader(InReader)
+            , Layouts(InLayouts)
+        {
+        }
+
+        /** Reads the opening brace of the document and applies the object that follows */
+        bool ApplyDocument(UObject* Object, bool bStartFromArchetype, FName OnlyProperty = NAME_None, bool* bOutApplied = nullptr)
+        {
+            EJsonNotation Notation;
+            if (!Reader.ReadNext(Notation) || Notation != EJsonNotation::ObjectStart)
+            {
+                return false;
+            }
+
+            if (bStartFromArchetype)
+            {
+                GeoBlueprintJsonPropertyDelta::ResetToArchetype(Object);
+            }
+            return ApplyObject(Object, bStartFromArchetype, OnlyProperty, bOutApplied);
+        }
+
+    private:
+        /** Applies the members of an object whose opening brace has already been read */
+        bool ApplyObject(UObject* Object, bool bStartFromArchetype, FName OnlyProperty, bool* bOutApplied)
+        {
+            const FGeoBlueprintJsonClassLayout& Layout = Layouts.Get(Object->GetClass());
+
+            EJsonNotation Notation;
+            while (Reader.ReadNext(Notation))
+            {
+                if (Notation == EJsonNotation::ObjectEnd)
+                {
+                    return true;
+                }
+                if (Notation == EJsonNotation::Error)
+                {
+                    return false;
+                }
+
+                // Names that were never turned into an FName can't belong to any property
+                const FName PropertyName(*Reader.GetIdentifier(), FNAME_Find);
+                const int32 FieldIndex = PropertyName.IsNone() || (!OnlyProperty.IsNone() && PropertyName != OnlyProperty)
+                    ? INDEX_NONE
+                    : Layout.FindFieldIndex(PropertyName);
+
+                if (FieldIndex == INDEX_NONE)
+                {
+                    if (!SkipValue(Notation))
+                    {
+                        return false;
+                    }
+                    continue;
+                }
+
+                bool bApplied = false;
+                if (!ApplyValue(Object, Layout.GetFields()[FieldIndex], Notation, bStartFromArchetype, bApplied))
+                {
+                    return false;
+                }
+                if (bOutApplied)
+                {
+                    *bOutApplied = bApplied;
+                }
+            }
+            return false;
+        }
+
+        bool ApplyValue(UObject* Object, const FGeoBlueprintJsonPropertyField& Field, EJsonNotation Notation, bool bStartFromArchetype, bool& bOutApplied)
+        {
+            if (Field.Kind == EGeoJsonPropertyKind::Object)
+            {
+                const FObjectProperty* ObjectProperty = CastFieldChecked<FObjectProperty>(Field.Property);
+                if (Notation == EJsonNotation::Null)
+                {
+                    ObjectProperty->SetObjectPropertyValue_InContainer(Object, nullptr);
+                    bOutApplied = true;
+                    return true;
+                }
+
+                // Only subobjects the container owns take nested values; anything else it references may be
+                // shared, and writing into it would change every other user too
+                UObject* ObjValue = GeoBlueprintJsonPropertyDelta::GetOwnedSubobject(ObjectProperty, Object);
+                if (!ObjValue)
+                {
+                    return SkipValue(Notation);
+                }
+
+                // Nested objects are normally written as JSON strings, but inline objects are accepted too
+                if (Notation == EJsonNotation::ObjectStart)
+                {
+                    if (bStartFromArchetype)
+                    {
+                        GeoBlueprintJsonPropertyDelta::ResetToArchetype(ObjValue);
+                    }
+                    bOutApplied = ApplyObject(ObjValue, bStartFromArchetype, NAME_None, nullptr);
+                    return bOutApplied;
+                }
+                if (Notation == EJsonNotation::String)
+                {
+                    TSharedRef<TJsonReader<TCHAR>> NestedReader = TJsonReaderFactory<TCHAR>::Create(Reader.GetValueAsString());
+                    TApplier<TCHAR> NestedApplier(*NestedReader, Layouts);
+                    bOutApplied = NestedApplier.ApplyDocument(ObjValue, bStartFromArchetype);
+                    return true;
+                }
+                return SkipValue(Notation);
+            }
+
+            switch (Field.Kind)
+            {
+            case EGeoJsonPropertyKind::String:
+                CastFieldChecked<FStrProperty>(Field.Property)->SetPropertyValue_InContainer(Object, ReadString(Notation));
+                break;
+            case EGeoJsonPropertyKind::Int:
+                CastFieldChecked<FIntProperty>(Field.Property)->SetPropertyValue_InContainer(Object, ReadNumber(Notation));
+                break;
+            case EGeoJsonPropertyKind::Float:
+                CastFieldChecked<FFloatProperty>(Field.Property)->SetPropertyValue_InContainer(Object, ReadNumber(Notation));
+                break;
+            case EGeoJsonPropertyKind::Bool:
+                CastFieldChecked<FBoolProperty>(Field.Property)->SetPropertyValue_InContainer(Object, ReadBool(Notation));
+                break;
+            default:
+                break;
+            }
+
+            bOutApplied = true;
+            return Notation == EJsonNotation::ObjectStart || Notation == EJsonNotation::ArrayStart ? SkipValue(Notation) : true;
+        }
+
+        bool SkipValue(EJsonNotation Notation)
+        {
+            if (Notation == EJsonNotation::ObjectStart)
+            {
+                return Reader.SkipObject();
+            }
+            if (Notation == EJsonNotation::ArrayStart)
+            {
+                return Reader.SkipArray();
+            }
+            return Notation != EJsonNotation::Error;
+        }
+
+        // Conversions mirror FJsonValue::AsString/AsNumber/AsBool, including their defaults on failure
+
+        FString ReadString(EJsonNotation Notation) const
+        {
+            switch (Notation)
+            {
+            case EJsonNotation::String:
+                return FString(Reader.GetValueAsString());
+            case EJsonNotation::Number:
+                return FString::SanitizeFloat(Reader.GetValueAsNumber(), 0);
+            case EJsonNotation::Boolean:
+                return Reader.GetValueAsBoolean() ? TEXT("true") : TEXT("false");
+            default:
+                return FString();
+            }
+        }
+
+        double ReadNumber(EJsonNotation Notation) const
+        {
+            switch (Notation)
+            {
+            case EJsonNotation::Number:
+                return Reader.GetValueAsNumber();
+            case EJsonNotation::String:
+            {
+                double Number = 0.0;
+                LexTryParseString(Number, *FString(Reader.GetValueAsString()));
+                return Number;
+            }
+            case EJsonNotation::Boolean:
+                return Reader.GetValueAsBoolean() ? 1.0 : 0.0;
+            default:
+                return 0.0;
+            }
+        }
+
+        bool ReadBool(EJsonNotation Notation) const
+        {
+            switch (Notation)
+            {
+            case EJsonNotation::Boolean:
+                return Reader.GetValueAsBoolean();
+            case EJsonNotation::Number:
+                return Reader.GetValueAsNumber() != 0.0;
+            case EJsonNotation::String:
+                return FString(Reader.GetValueAsString()).ToBool();
+            default:
+                return false;
+            }
+        }
+
+        TJsonReader<CharType>& Reader;
+        FGeoBlueprintJsonClassLayoutCache& Layouts;
+    };
+}
+
+bool FGeoBlueprintJsonStreamingReader::ApplyString(const FString& JsonString, UObject* Object, bool bStartFromArchetype)
+{
+    if (JsonString.IsEmpty() || !Object)
+    {
+        return false;
+    }
+
+    FGeoBlueprintJsonClassLayoutCache Layouts;
+    TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<TCHAR>::Create(JsonString);
+    GeoBlueprintJsonStreamingReader::TApplier<TCHAR> Applier(*Reader, Layouts);
+    return Applier.ApplyDocument(Object, bStartFromArchetype);
+}
+
+bool FGeoBlueprintJsonStreamingReader::ApplyFile(const FString& FilePath, UObject* Object, bool bStartFromArchetype)
+{
+    if (!Object)
+    {
+        return false;
+    }
+
+    TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*FilePath));
+    if (!FileReader)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Could not open %s"), *FilePath);
+        return false;
+    }
+
+    FGeoBlueprintJsonClassLayoutCache Layouts;
+    TSharedRef<TJsonReader<UTF8CHAR>> Reader = TJsonReaderFactory<UTF8CHAR>::Create(FileReader.Get());
+    GeoBlueprintJsonStreamingReader::TApplier<UTF8CHAR> Applier(*Reader, Layouts);
+    const bool bSucceeded = Applier.ApplyDocument(Object, bStartFromArchetype);
+    if (!bSucceeded)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to apply %s: %s"), *FilePath, *Reader->GetErrorMessage());
+    }
+    return bSucceeded;
+}
+
+bool FGeoBlueprintJsonStreamingReader::ApplyProperty(const FString& JsonString, UObject* Object, FName PropertyName)
+{
+    if (JsonString.IsEmpty() || !Object || PropertyName.IsNone())
+    {
+        return false;
+    }
+
+    bool bApplied = false;
+    FGeoBlueprintJsonClassLayoutCache Layouts;
+    TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<TCHAR>::Create(JsonString);
+    GeoBlueprintJsonStreamingReader::TApplier<TCHAR> Applier(*Reader, Layouts);
+    return Applier.ApplyDocument(Object, false, PropertyName, &bApplied) && bApplied;
+}
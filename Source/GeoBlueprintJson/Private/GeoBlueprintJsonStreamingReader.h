@@ -0,0 +1,26 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UObject;
+
+/**
+ * Applies JSON to objects straight from reader tokens. Property names are matched against a
+ * per-class layout as they are read and values are written directly into property memory, so no
+ * DOM is built and memory grows with the nesting depth of the input rather than its size.
+ *
+ * Values are converted the way FJsonValue converts them, so the result matches applying a parsed
+ * FJsonObject. Properties are applied in input order; when the input is malformed, everything
+ * before the error has already been applied.
+ */
+class FGeoBlueprintJsonStreamingReader
+{
+public:
+    static bool ApplyString(const FString& JsonString, UObject* Object, bool bStartFromArchetype);
+
+    /** Streams a UTF-8 file from disk without loading it into memory first */
+    static bool ApplyFile(const FString& FilePath, UObject* Object, bool bStartFromArchetype);
+
+    /** Applies only the named top level property. Returns false when it is missing or can't be applied. */
+    static bool ApplyProperty(const FString& JsonString, UObject* Object, FName PropertyName);
+};
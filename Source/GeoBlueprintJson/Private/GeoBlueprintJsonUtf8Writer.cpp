@@ -0,0 +1,474 @@
+#include "GeoBlueprintJsonUtf8Writer.h"
+#include "GeoBlueprintJsonDom.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/UnrealMathUtility.h"
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS && PLATFORM_CPU_X86_FAMILY
+#define GEO_JSON_WRITER_SSE2 1
+#include <emmintrin.h>
+#define GEO_JSON_WRITER_AVX2 1
+#include <immintrin.h>
+// Default x64 targets only guarantee SSE; clang and gcc then need the kernel itself marked as AVX2 code
+#if PLATFORM_ALWAYS_HAS_AVX_2 || (defined(_MSC_VER) && !defined(__clang__))
+#define GEO_JSON_WRITER_AVX2_TARGET
+#else
+#define GEO_JSON_WRITER_AVX2_TARGET __attribute__((target("avx2")))
+#endif
+#elif PLATFORM_ENABLE_VECTORINTRINSICS_NEON && PLATFORM_CPU_ARM_FAMILY && PLATFORM_64BITS
+#define GEO_JSON_WRITER_NEON 1
+#include <arm_neon.h>
+#endif
+
+#ifndef GEO_JSON_WRITER_SSE2
+#define GEO_JSON_WRITER_SSE2 0
+#endif
+#ifndef GEO_JSON_WRITER_AVX2
+#define GEO_JSON_WRITER_AVX2 0
+#endif
+#ifndef GEO_JSON_WRITER_NEON
+#define GEO_JSON_WRITER_NEON 0
+#endif
+
+static TAutoConsoleVariable<bool> CVarGeoBlueprintJsonSimdWriter(
+    TEXT("GeoBlueprintJson.SimdWriter"),
+    true,
+    TEXT("Use vector instructions to find and copy plain ASCII runs when writing UTF-8 JSON. 0 forces the scalar path."));
+
+namespace GeoBlueprintJsonUtf8Writer
+{
+    static_assert(sizeof(TCHAR) == 2, "The vector kernels read TCHAR strings as UTF-16 code units");
+
+    // Plain characters are copied as-is: printable ASCII other than the quote and the backslash
+    FORCEINLINE bool IsPlainAscii(uint32 Char)
+    {
+        return Char >= 0x20 && Char < 0x80 && Char != '"' && Char != '\\';
+    }
+
+    int32 CopyAsciiRunScalar(const TCHAR* Source, int32 Len, uint8* Dest)
+    {
+        int32 Index = 0;
+        for (; Index < Len && IsPlainAscii(static_cast<uint32>(Source[Index])); ++Index)
+        {
+            Dest[Index] = static_cast<uint8>(Source[Index]);
+        }
+        return Index;
+    }
+
+#if GEO_JSON_WRITER_SSE2
+    int32 CopyAsciiRunSse2(const TCHAR* Source, int32 Len, uint8* Dest)
+    {
+        const __m128i HighBits = _mm_set1_epi16(static_cast<int16>(0xFF80));
+        const __m128i Space = _mm_set1_epi16(0x20);
+        const __m128i Quote = _mm_set1_epi16('"');
+        const __m128i Backslash = _mm_set1_epi16('\\');
+        const __m128i Zero = _mm_setzero_si128();
+
+        int32 Index = 0;
+        for (; Index + 8 <= Len; Index += 8)
+        {
+            const __m128i Chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + Index));
+
+            // Lanes at or above 0x8000 compare as negative, which only matters for lanes already rejected as non-ASCII
+            const __m128i IsAscii = _mm_cmpeq_epi16(_mm_and_si128(Chars, HighBits), Zero);
+            const __m128i IsEscaped = _mm_or_si128(_mm_cmplt_epi16(Chars, Space), _mm_or_si128(_mm_cmpeq_epi16(Chars, Quote), _mm_cmpeq_epi16(Chars, Backslash)));
+            const uint32 PlainMask = static_cast<uint32>(_mm_movemask_epi8(IsAscii) & ~_mm_movemask_epi8(IsEscaped)) & 0xFFFF;
+
+            // The whole block is stored even when only a prefix is plain; the caller only keeps the prefix
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(Dest + Index), _mm_packus_epi16(Chars, Chars));
+            if (PlainMask != 0xFFFF)
+            {
+                return Index + static_cast<int32>(FMath::CountTrailingZeros(~PlainMask)) / 2;
+            }
+        }
+        return Index + CopyAsciiRunScalar(Source + Index, Len - Index, Dest + Index);
+    }
+#endif
+
+#if GEO_JSON_WRITER_AVX2
+    GEO_JSON_WRITER_AVX2_TARGET int32 CopyAsciiRunAvx2(const TCHAR* Source, int32 Len, uint8* Dest)
+    {
+        const __m256i HighBits = _mm256_set1_epi16(static_cast<int16>(0xFF80));
+        const __m256i Space = _mm256_set1_epi16(0x20);
+        const __m256i Quote = _mm256_set1_epi16('"');
+        const __m256i Backslash = _mm256_set1_epi16('\\');
+        const __m256i Zero = _mm256_setzero_si256();
+
+        int32 Index = 0;
+        for (; Index + 16 <= Len; Index += 16)
+        {
+            const __m256i Chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Source + Index));
+            const __m256i IsAscii = _mm256_cmpeq_epi16(_mm256_and_si256(Chars, HighBits), Zero);
+            const __m256i IsEscaped = _mm256_or_si256(_mm256_cmpgt_epi16(Space, Chars), _mm256_or_si256(_mm256_cmpeq_epi16(Chars, Quote), _mm256_cmpeq_epi16(Chars, Backslash)));
+            const uint32 PlainMask = static_cast<uint32>(_mm256_movemask_epi8(IsAscii)) & ~static_cast<uint32>(_mm256_movemask_epi8(IsEscaped));
+
+            // packus works per 128-bit lane, so the two narrowed halves are brought together before the store
+            const __m256i Packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(Chars, Chars), 0xD8);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(Dest + Index), _mm256_castsi256_si128(Packed));
+            if (PlainMask != 0xFFFFFFFF)
+            {
+                return Index + static_cast<int32>(FMath::CountTrailingZeros(~PlainMask)) / 2;
+            }
+        }
+        return Index + CopyAsciiRunSse2(Source + Index, Len - Index, Dest + Index);
+    }
+#endif
+
+#if GEO_JSON_WRITER_NEON
+    int32 CopyAsciiRunNeon(const TCHAR* Source, int32 Len, uint8* Dest)
+    {
+        const uint16x8_t FirstNonAscii = vdupq_n_u16(0x80);
+        const uint16x8_t Space = vdupq_n_u16(0x20);
+        const uint16x8_t Quote = vdupq_n_u16('"');
+        const uint16x8_t Backslash = vdupq_n_u16('\\');
+
+        int32 Index = 0;
+        for (; Index + 8 <= Len; Index += 8)
+        {
+            const uint16x8_t Chars = vld1q_u16(reinterpret_cast<const uint16_t*>(Source + Index));
+            const uint16x8_t IsSpecial = vorrq_u16(
+                vorrq_u16(vcgeq_u16(Chars, FirstNonAscii), vcltq_u16(Chars, Space)),
+                vorrq_u16(vceqq_u16(Chars, Quote), vceqq_u16(Chars, Backslash)));
+            if (vmaxvq_u16(IsSpecial) != 0)
+            {
+                break;
+            }
+            vst1_u8(Dest + Index, vmovn_u16(Chars));
+        }
+
+        // The scalar loop finds the exact end of the run inside the block that stopped the vector loop
+        return Index + CopyAsciiRunScalar(Source + Index, Len - Index, Dest + Index);
+    }
+#endif
+
+    const ANSICHAR HexDigits[] = "0123456789abcdef";
+
+#if GEO_JSON_WRITER_AVX2
+    /** CPUID and OS support for the YMM registers, checked once per process */
+    bool HasAvx2()
+    {
+#if PLATFORM_ALWAYS_HAS_AVX_2
+        return true;
+#elif PLATFORM_WINDOWS || PLATFORM_UNIX
+        static const bool bHasAvx2 = FPlatformMisc::HasAVX2InstructionSet();
+        return bHasAvx2;
+#else
+        return false;
+#endif
+    }
+#endif
+
+    using FCopyAsciiRun = int32 (*)(const TCHAR*, int32, uint8*);
+
+    /** The fastest kernel this CPU runs, or the scalar one when GeoBlueprintJson.SimdWriter is off */
+    FCopyAsciiRun SelectKernel(const TCHAR*& OutName)
+    {
+        if (CVarGeoBlueprintJsonSimdWriter.GetValueOnAnyThread())
+        {
+#if GEO_JSON_WRITER_AVX2
+            if (HasAvx2())
+            {
+                OutName = TEXT("AVX2");
+                return &CopyAsciiRunAvx2;
+            }
+#endif
+#if GEO_JSON_WRITER_SSE2
+            OutName = TEXT("SSE2");
+            return &CopyAsciiRunSse2;
+#elif GEO_JSON_WRITER_NEON
+            OutName = TEXT("NEON");
+            return &CopyAsciiRunNeon;
+#endif
+        }
+        OutName = TEXT("Scalar");
+        return &CopyAsciiRunScalar;
+    }
+}
+
+FGeoJsonUtf8Writer::FGeoJsonUtf8Writer(TArray<uint8>& InOutBytes, bool bInPrettyPrint)
+    : Bytes(InOutBytes)
+    , bPrettyPrint(bInPrettyPrint)
+{
+    const TCHAR* KernelName = nullptr;
+    CopyAsciiRun = GeoBlueprintJsonUtf8Writer::SelectKernel(KernelName);
+}
+
+const TCHAR* FGeoJsonUtf8Writer::GetKernelName()
+{
+    const TCHAR* KernelName = nullptr;
+    GeoBlueprintJsonUtf8Writer::SelectKernel(KernelName);
+    return KernelName;
+}
+
+void FGeoJsonUtf8Writer::WriteRootValue(const FGeoJsonValue& Value)
+{
+    WriteElement(Value);
+}
+
+// Element and field layout follows TJsonWriter token for token, see WriteValue/WriteObjectStart/WriteArrayStart there
+void FGeoJsonUtf8Writer::WriteElement(const FGeoJsonValue& Value)
+{
+    switch (Value.Type)
+    {
+    case EGeoJsonType::Object:
+        if (PreviousToken != EToken::None)
+        {
+            WriteCommaIfNeeded();
+            WriteLineTerminator();
+            WriteTabs();
+        }
+        WriteChar('{');
+        ++IndentLevel;
+        PreviousToken = EToken::CurlyOpen;
+        WriteFields(*Value.Object);
+        WriteObjectEnd();
+        break;
+    case EGeoJsonType::Array:
+        if (PreviousToken != EToken::None)
+        {
+            WriteCommaIfNeeded();
+            WriteLineTerminator();
+            WriteTabs();
+        }
+        WriteChar('[');
+        ++IndentLevel;
+        PreviousToken = EToken::SquareOpen;
+        WriteElements(*Value.Array);
+        WriteArrayEnd();
+        break;
+    case EGeoJsonType::String:
+        // String elements always start a new line
+        WriteCommaIfNeeded();
+        WriteLineTerminator();
+        WriteTabs();
+        WriteString(Value.String.View());
+        PreviousToken = EToken::String;
+        break;
+    default:
+        // Short values share a line with the bracket or the short value before them
+        WriteCommaIfNeeded();
+        if (PreviousToken == EToken::SquareOpen
+            || PreviousToken == EToken::Number
+            || PreviousToken == EToken::True
+            || PreviousToken == EToken::False
+            || PreviousToken == EToken::Null)
+        {
+            WriteSpace();
+        }
+        else
+        {
+            WriteLineTerminator();
+            WriteTabs();
+        }
+        PreviousToken = WriteScalar(Value);
+        break;
+    }
+}
+
+void FGeoJsonUtf8Writer::WriteField(FStringView Key, const FGeoJsonValue& Value)
+{
+    WriteCommaIfNeeded();
+    WriteLineTerminator();
+    WriteTabs();
+    WriteString(Key);
+    WriteChar(':');
+
+    switch (Value.Type)
+    {
+    case EGeoJsonType::Object:
+        WriteLineTerminator();
+        WriteTabs();
+        WriteChar('{');
+        ++IndentLevel;
+        PreviousToken = EToken::CurlyOpen;
+        WriteFields(*Value.Object);
+        WriteObjectEnd();
+        break;
+    case EGeoJsonType::Array:
+        WriteSpace();
+        WriteChar('[');
+        ++IndentLevel;
+        PreviousToken = EToken::SquareOpen;
+        WriteElements(*Value.Array);
+        WriteArrayEnd();
+        break;
+    case EGeoJsonType::String:
+        WriteSpace();
+        WriteString(Value.String.View());
+        PreviousToken = EToken::String;
+        break;
+    default:
+        WriteSpace();
+        PreviousToken = WriteScalar(Value);
+        break;
+    }
+}
+
+void FGeoJsonUtf8Writer::WriteFields(const FGeoJsonObject& Object)
+{
+    for (const FGeoJsonField& Field : Object.Fields)
+    {
+        WriteField(Field.Key.View(), Field.Value);
+    }
+}
+
+void FGeoJsonUtf8Writer::WriteElements(const FGeoJsonArray& Array)
+{
+    for (const FGeoJsonValue& Element : Array.Values)
+    {
+        WriteElement(Element);
+    }
+}
+
+void FGeoJsonUtf8Writer::WriteObjectEnd()
+{
+    WriteLineTerminator();
+    --IndentLevel;
+    WriteTabs();
+    WriteChar('}');
+    PreviousToken = EToken::CurlyClose;
+}
+
+void FGeoJsonUtf8Writer::WriteArrayEnd()
+{
+    --IndentLevel;
+    if (PreviousToken == EToken::SquareClose || PreviousToken == EToken::CurlyClose || PreviousToken == EToken::String)
+    {
+        WriteLineTerminator();
+        WriteTabs();
+    }
+    else if (PreviousToken != EToken::SquareOpen)
+    {
+        WriteSpace();
+    }
+    WriteChar(']');
+    PreviousToken = EToken::SquareClose;
+}
+
+FGeoJsonUtf8Writer::EToken FGeoJsonUtf8Writer::WriteScalar(const FGeoJsonValue& Value)
+{
+    switch (Value.Type)
+    {
+    case EGeoJsonType::Bool:
+        if (Value.Bool)
+        {
+            WriteAscii("true", 4);
+            return EToken::True;
+        }
+        WriteAscii("false", 5);
+        return EToken::False;
+    case EGeoJsonType::Number:
+        WriteNumber(Value.Number);
+        return EToken::Number;
+    default:
+        WriteAscii("null", 4);
+        return EToken::Null;
+    }
+}
+
+void FGeoJsonUtf8Writer::WriteNumber(double Value)
+{
+    // Same formatting as TJsonPrintPolicy::WriteDouble; the result is always ASCII
+    const FString Number = FString::Printf(TEXT("%.17g"), Value);
+    const int32 Offset = Bytes.AddUninitialized(Number.Len());
+    for (int32 Index = 0; Index < Number.Len(); ++Index)
+    {
+        Bytes[Offset + Index] = static_cast<uint8>(Number[Index]);
+    }
+}
+
+void FGeoJsonUtf8Writer::WriteString(FStringView String)
+{
+    using namespace GeoBlueprintJsonUtf8Writer;
+
+    const TCHAR* Source = String.GetData();
+    const int32 Len = String.Len();
+
+    WriteChar('"');
+    int32 Index = 0;
+    while (Index < Len)
+    {
+        // Room for the rest of the string as ASCII; whatever the run doesn't use is given back
+        const int32 Offset = Bytes.AddUninitialized(Len - Index);
+        const int32 RunLen = CopyAsciiRun(Source + Index, Len - Index, Bytes.GetData() + Offset);
+        Bytes.SetNum(Offset + RunLen, EAllowShrinking::No);
+        Index += RunLen;
+        if (Index == Len)
+        {
+            break;
+        }
+
+        const uint32 Char = static_cast<uint32>(Source[Index]);
+        if (Char >= 0x80)
+        {
+            // Non-ASCII runs go through the engine converter, so surrogates come out exactly as FTCHARToUTF8 writes them
+            int32 RunEnd = Index + 1;
+            while (RunEnd < Len && static_cast<uint32>(Source[RunEnd]) >= 0x80)
+            {
+                ++RunEnd;
+            }
+            const int32 Utf8Len = FPlatformString::ConvertedLength<UTF8CHAR>(Source + Index, RunEnd - Index);
+            const int32 Utf8Offset = Bytes.AddUninitialized(Utf8Len);
+            FPlatformString::Convert(reinterpret_cast<UTF8CHAR*>(Bytes.GetData() + Utf8Offset), Utf8Len, Source + Index, RunEnd - Index);
+            Index = RunEnd;
+            continue;
+        }
+
+        // Same escapes as TJsonWriter: named escapes where JSON has them, \u00xx for other control characters
+        switch (Char)
+        {
+        case '\\': WriteAscii("\\\\", 2); break;
+        case '\n': WriteAscii("\\n", 2); break;
+        case '\t': WriteAscii("\\t", 2); break;
+        case '\b': WriteAscii("\\b", 2); break;
+        case '\f': WriteAscii("\\f", 2); break;
+        case '\r': WriteAscii("\\r", 2); break;
+        case '"': WriteAscii("\\\"", 2); break;
+        default:
+            {
+                const ANSICHAR Escaped[] = { '\\', 'u', '0', '0', HexDigits[Char >> 4], HexDigits[Char & 0xF] };
+                WriteAscii(Escaped, UE_ARRAY_COUNT(Escaped));
+            }
+            break;
+        }
+        ++Index;
+    }
+    WriteChar('"');
+}
+
+void FGeoJsonUtf8Writer::WriteCommaIfNeeded()
+{
+    if (PreviousToken != EToken::CurlyOpen && PreviousToken != EToken::SquareOpen)
+    {
+        WriteChar(',');
+    }
+}
+
+void FGeoJsonUtf8Writer::WriteLineTerminator()
+{
+    if (bPrettyPrint)
+    {
+        WriteAscii(LINE_TERMINATOR_ANSI, UE_ARRAY_COUNT(LINE_TERMINATOR_ANSI) - 1);
+    }
+}
+
+void FGeoJsonUtf8Writer::WriteTabs()
+{
+    if (bPrettyPrint && IndentLevel > 0)
+    {
+        const int32 Offset = Bytes.AddUninitialized(IndentLevel);
+        FMemory::Memset(Bytes.GetData() + Offset, '\t', IndentLevel);
+    }
+}
+
+void FGeoJsonUtf8Writer::WriteSpace()
+{
+    if (bPrettyPrint)
+    {
+        WriteChar(' ');
+    }
+}
+
+void FGeoJsonUtf8Writer::WriteAscii(const ANSICHAR* String, int32 Len)
+{
+    Bytes.Append(reinterpret_cast<const uint8*>(String), Len);
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FGeoJsonValue;
+struct FGeoJsonObject;
+struct FGeoJsonArray;
+
+/**
+ * Writes arena DOM values straight to UTF-8. The token layout mirrors TJsonWriter with the pretty
+ * and condensed print policies, and strings are escaped the way TJsonWriter escapes them, so the
+ * bytes match converting the TCHAR output of FGeoJsonObject::Serialize with FTCHARToUTF8.
+ *
+ * Strings are escaped and transcoded in one pass. Runs of plain ASCII are found and narrowed a
+ * block at a time with SSE2/AVX2 or NEON; everything else takes the scalar path, which is also
+ * used for the whole string when vector code isn't available or GeoBlueprintJson.SimdWriter is 0.
+ */
+class FGeoJsonUtf8Writer
+{
+public:
+    /** Appends to OutBytes */
+    FGeoJsonUtf8Writer(TArray<uint8>& InOutBytes, bool bInPrettyPrint);
+
+    void WriteRootValue(const FGeoJsonValue& Value);
+
+    /** Name of the kernel used for ASCII runs: "AVX2", "SSE2", "NEON" or "Scalar" */
+    static const TCHAR* GetKernelName();
+
+private:
+    enum class EToken : uint8
+    {
+        None,
+        CurlyOpen,
+        CurlyClose,
+        SquareOpen,
+        SquareClose,
+        String,
+        Number,
+        True,
+        False,
+        Null
+    };
+
+    void WriteElement(const FGeoJsonValue& Value);
+    void WriteField(FStringView Key, const FGeoJsonValue& Value);
+    void WriteFields(const FGeoJsonObject& Object);
+    void WriteElements(const FGeoJsonArray& Array);
+    void WriteObjectEnd();
+    void WriteArrayEnd();
+
+    EToken WriteScalar(const FGeoJsonValue& Value);
+    void WriteString(FStringView String);
+    void WriteNumber(double Value);
+
+    void WriteCommaIfNeeded();
+    void WriteLineTerminator();
+    void WriteTabs();
+    void WriteSpace();
+    void WriteChar(ANSICHAR Char) { Bytes.Add(static_cast<uint8>(Char)); }
+    void WriteAscii(const ANSICHAR* String, int32 Len);
+
+    using FCopyAsciiRun = int32(*)(const TCHAR* Source, int32 Len, uint8* Dest);
+
+    TArray<uint8>& Bytes;
+    FCopyAsciiRun CopyAsciiRun;
+    bool bPrettyPrint;
+    int32 IndentLevel = 0;
+    EToken PreviousToken = EToken::None;
+};
@@ -0,0 +1,371 @@
+#include "GeoBlueprintJsonWorldSnapshot.h"
+#include "GeoBlueprintJsonDom.h"
+#include "GeoBlueprintJsonPropertyLayout.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Components/ActorComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "UObject/UnrealType.h"
+
+/** One captured property value. Numbers and bools are held in Number; strings and objects by index. */
+struct FGeoBlueprintJsonSnapshotValue
+{
+    double Number = 0.0;
+    int32 Index = INDEX_NONE;
+};
+
+struct FGeoBlueprintJsonSnapshotObject
+{
+    const FGeoBlueprintJsonClassLayout* Layout = nullptr;
+    FName Name;
+    int32 OwnerIndex = INDEX_NONE;
+    int32 Depth = 0;
+
+    /** Full path, only kept for objects outside the captured actors and their components */
+    FString Path;
+
+    /** First entry in Values; the object owns one value per field of its layout */
+    int32 FirstValue = INDEX_NONE;
+};
+
+class FGeoBlueprintJsonWorldSnapshotData
+{
+public:
+    FString WorldPath;
+    double WorldTimeSeconds = 0.0;
+    double GatherMs = 0.0;
+
+    FGeoBlueprintJsonClassLayoutCache Layouts;
+    TArray<FGeoBlueprintJsonSnapshotObject> Objects;
+    TArray<FGeoBlueprintJsonSnapshotValue> Values;
+    TArray<FString> Strings;
+    TArray<int32> ActorIndices;
+};
+
+namespace GeoBlueprintJsonWorldSnapshot
+{
+    /** Objects serialized per worker task */
+    static constexpr int32 ObjectsPerTask = 256;
+
+    static bool PassesFilter(const AActor* Actor, const FGeoBlueprintJsonWorldSnapshotFilter& Filter)
+    {
+        if (Filter.ActorClasses.Num() > 0)
+        {
+            const bool bClassMatches = Filter.ActorClasses.ContainsByPredicate([Actor](const TSubclassOf<AActor>& ActorClass)
+            {
+                return ActorClass && Actor->IsA(ActorClass);
+            });
+            if (!bClassMatches)
+            {
+                return false;
+            }
+        }
+
+        if (Filter.ActorTags.Num() > 0)
+        {
+            const bool bTagMatches = Filter.ActorTags.ContainsByPredicate([Actor](const FName& Tag)
+            {
+                return Actor->ActorHasTag(Tag);
+            });
+            if (!bTagMatches)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    class FGatherer
+    {
+    public:
+        FGatherer(FGeoBlueprintJsonWorldSnapshotData& InData, int32 InMaxReferenceDepth)
+            : Data(InData)
+            , MaxReferenceDepth(InMaxReferenceDepth)
+        {
+        }
+
+        /** Returns the index of the object, adding it the first time it is seen so shared objects are captured once */
+        int32 AddObject(const UObject* Object, int32 OwnerIndex, int32 Depth)
+        {
+            if (const int32* ExistingIndex = IndexByObject.Find(Object))
+            {
+                return *ExistingIndex;
+            }
+
+            const int32 Index = Data.Objects.Num();
+            IndexByObject.Add(Object, Index);
+            PendingObjects.Add(Object);
+
+            FGeoBlueprintJsonSnapshotObject& Entry = Data.Objects.AddDefaulted_GetRef();
+            Entry.Layout = &Data.Layouts.Get(Object->GetClass());
+            Entry.Name = Object->GetFName();
+            Entry.OwnerIndex = OwnerIndex;
+            Entry.Depth = Depth;
+            if (Depth > 0)
+            {
+                Entry.Path = Object->GetPathName();
+            }
+            return Index;
+        }
+
+        /** Copies the property values of every pending object, including objects discovered along the way */
+        void CaptureValues()
+        {
+            for (int32 Index = 0; Index < PendingObjects.Num(); ++Index)
+            {
+                if (Data.Objects[Index].Depth <= MaxReferenceDepth)
+                {
+                    CaptureObjectValues(Index);
+                }
+            }
+        }
+
+    private:
+        void CaptureObjectValues(int32 Index)
+        {
+            const UObject* Object = PendingObjects[Index];
+            const FGeoBlueprintJsonClassLayout& Layout = *Data.Objects[Index].Layout;
+            const int32 Depth = Data.Objects[Index].Depth;
+            const TArray<FGeoBlueprintJsonPropertyField>& Fields = Layout.GetFields();
+
+            const int32 FirstValue = Data.Values.AddDefaulted(Fields.Num());
+            Data.Objects[Index].FirstValue = FirstValue;
+
+            for (int32 FieldIndex = 0; FieldIndex < Fields.Num(); ++FieldIndex)
+            {
+                const FGeoBlueprintJsonPropertyField& Field = Fields[FieldIndex];
+                FGeoBlueprintJsonSnapshotValue& Value = Data.Values[FirstValue + FieldIndex];
+
+                switch (Field.Kind)
+                {
+                case EGeoJsonPropertyKind::String:
+                    Value.Index = Data.Strings.Add(CastFieldChecked<FStrProperty>(Field.Property)->GetPropertyValue_InContainer(Object));
+                    break;
+                case EGeoJsonPropertyKind::Int:
+                    Value.Number = CastFieldChecked<FIntProperty>(Field.Property)->GetPropertyValue_InContainer(Object);
+                    break;
+                case EGeoJsonPropertyKind::Float:
+                    Value.Number = CastFieldChecked<FFloatProperty>(Field.Property)->GetPropertyValue_InContainer(Object);
+                    break;
+                case EGeoJsonPropertyKind::Bool:
+                    Value.Number = CastFieldChecked<FBoolProperty>(Field.Property)->GetPropertyValue_InContainer(Object) ? 1.0 : 0.0;
+                    break;
+                case EGeoJsonPropertyKind::Object:
+                    if (const UObject* Referenced = CastFieldChecked<FObjectProperty>(Field.Property)->GetObjectPropertyValue_InContainer(Object))
+                    {
+                        Value.Index = AddObject(Referenced, INDEX_NONE, Depth + 1);
+                    }
+                    break;
+                }
+            }
+        }
+
+        FGeoBlueprintJsonWorldSnapshotData& Data;
+        int32 MaxReferenceDepth;
+        TMap<const UObject*, int32> IndexByObject;
+        TArray<const UObject*> PendingObjects;
+    };
+
+    static void BuildObject(FGeoJsonObject& ObjectJson, const FGeoBlueprintJsonWorldSnapshotData& Data, int32 Index)
+    {
+        const FGeoBlueprintJsonSnapshotObject& Entry = Data.Objects[Index];
+        ObjectJson.SetNumberField(TEXT("Id"), Index);
+        ObjectJson.SetStringField(TEXT("Name"), Entry.Name.ToString());
+        ObjectJson.SetStringField(TEXT("Class"), Entry.Layout->GetClassPath());
+        if (Entry.OwnerIndex != INDEX_NONE)
+        {
+            ObjectJson.SetNumberField(TEXT("Owner"), Entry.OwnerIndex);
+        }
+        if (!Entry.Path.IsEmpty())
+        {
+            ObjectJson.SetStringField(TEXT("Path"), Entry.Path);
+        }
+        if (Entry.FirstValue == INDEX_NONE)
+        {
+            return;
+        }
+
+        FGeoJsonObject* PropertiesJson = ObjectJson.SetObjectField(TEXT("Properties"));
+        const TArray<FGeoBlueprintJsonPropertyField>& Fields = Entry.Layout->GetFields();
+        for (int32 FieldIndex = 0; FieldIndex < Fields.Num(); ++FieldIndex)
+        {
+            const FGeoBlueprintJsonPropertyField& Field = Fields[FieldIndex];
+            const FGeoBlueprintJsonSnapshotValue& Value = Data.Values[Entry.FirstValue + FieldIndex];
+
+            switch (Field.Kind)
+            {
+            case EGeoJsonPropertyKind::String:
+                PropertiesJson->SetStringField(Field.Name, Data.Strings[Value.Index]);
+                break;
+            case EGeoJsonPropertyKind::Int:
+            case EGeoJsonPropertyKind::Float:
+                PropertiesJson->SetNumberField(Field.Name, Value.Number);
+                break;
+            case EGeoJsonPropertyKind::Bool:
+                PropertiesJson->SetBoolField(Field.Name, Value.Number != 0.0);
+                break;
+            case EGeoJsonPropertyKind::Object:
+                // Null references are left out, as in ConvertBlueprintToJson
+                if (Value.Index != INDEX_NONE)
+                {
+                    PropertiesJson->SetObjectField(Field.Name)->SetNumberField(TEXT("$ref"), Value.Index);
+                }
+                break;
+            }
+        }
+    }
+}
+
+TSharedRef<FGeoBlueprintJsonWorldSnapshotData> FGeoBlueprintJsonWorldSnapshot::Gather(UWorld* World, const FGeoBlueprintJsonWorldSnapshotFilter& Filter)
+{
+    check(IsInGameThread());
+    const double StartTime = FPlatformTime::Seconds();
+
+    TSharedRef<FGeoBlueprintJsonWorldSnapshotData> Data = MakeShared<FGeoBlueprintJsonWorldSnapshotData>();
+    if (!World)
+    {
+        return Data;
+    }
+
+    Data->WorldPath = World->GetPathName();
+    Data->WorldTimeSeconds = World->GetTimeSeconds();
+
+    GeoBlueprintJsonWorldSnapshot::FGatherer Gatherer(*Data, FMath::Max(Filter.MaxReferenceDepth, 0));
+    for (TActorIterator<AActor> It(World); It; ++It)
+    {
+        AActor* Actor = *It;
+        if (!GeoBlueprintJsonWorldSnapshot::PassesFilter(Actor, Filter))
+        {
+            continue;
+        }
+
+        const int32 ActorIndex = Gatherer.AddObject(Actor, INDEX_NONE, 0);
+        Data->ActorIndices.Add(ActorIndex);
+
+        if (Filter.bIncludeComponents)
+        {
+            Actor->ForEachComponent(false, [&Gatherer, ActorIndex](UActorComponent* Component)
+            {
+                Gatherer.AddObject(Component, ActorIndex, 0);
+            });
+        }
+    }
+    Gatherer.CaptureValues();
+
+    Data->GatherMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    return Data;
+}
+
+FString FGeoBlueprintJsonWorldSnapshot::Serialize(const FGeoBlueprintJsonWorldSnapshotData& Data)
+{
+    const int32 NumObjects = Data.Objects.Num();
+    const int32 NumTasks = FMath::DivideAndRoundUp(NumObjects, GeoBlueprintJsonWorldSnapshot::ObjectsPerTask);
+
+    // Each task writes a comma separated run of condensed objects into its own string
+    TArray<FString> TaskStrings;
+    TaskStrings.SetNum(NumTasks);
+    ParallelFor(NumTasks, [&Data, &TaskStrings, NumObjects](int32 TaskIndex)
+    {
+        const int32 FirstObject = TaskIndex * GeoBlueprintJsonWorldSnapshot::ObjectsPerTask;
+        const int32 LastObject = FMath::Min(FirstObject + GeoBlueprintJsonWorldSnapshot::ObjectsPerTask, NumObjects);
+
+        FGeoJsonArena Arena;
+        FString ObjectString;
+        FString& TaskString = TaskStrings[TaskIndex];
+        for (int32 Index = FirstObject; Index < LastObject; ++Index)
+        {
+            Arena.Reset();
+            FGeoJsonObject ObjectJson(Arena);
+            GeoBlueprintJsonWorldSnapshot::BuildObject(ObjectJson, Data, Index);
+
+            ObjectString.Reset();
+            ObjectJson.Serialize(ObjectString, false);
+            if (Index != FirstObject)
+            {
+                TaskString += TEXT(",");
+            }
+            TaskString += ObjectString;
+        }
+    });
+
+    FGeoJsonArena Arena;
+    FGeoJsonObject HeaderJson(Arena);
+    HeaderJson.SetStringField(TEXT("World"), Data.WorldPath);
+    HeaderJson.SetNumberField(TEXT("WorldTimeSeconds"), Data.WorldTimeSeconds);
+    HeaderJson.SetNumberField(TEXT("GameThreadMs"), Data.GatherMs);
+    FGeoJsonArray* ActorsJson = HeaderJson.SetArrayField(TEXT("Actors"));
+    for (const int32 ActorIndex : Data.ActorIndices)
+    {
+        ActorsJson->AddNumber(ActorIndex);
+    }
+
+    // The header is closed off by hand so the object runs can be appended without another copy through the writer
+    FString OutputString;
+    HeaderJson.Serialize(OutputString, false);
+    OutputString.LeftChopInline(1);
+
+    int32 TotalLength = OutputString.Len() + 16;
+    for (const FString& TaskString : TaskStrings)
+    {
+        TotalLength += TaskString.Len() + 1;
+    }
+    OutputString.Reserve(TotalLength);
+
+    OutputString += TEXT(",\"Objects\":[");
+    for (int32 TaskIndex = 0; TaskIndex < TaskStrings.Num(); ++TaskIndex)
+    {
+        if (TaskIndex > 0)
+        {
+            OutputString += TEXT(",");
+        }
+        OutputString += TaskStrings[TaskIndex];
+    }
+    OutputString += TEXT("]}");
+    return OutputString;
+}
+
+FString FGeoBlueprintJsonWorldSnapshot::Capture(UWorld* World, const FGeoBlueprintJsonWorldSnapshotFilter& Filter)
+{
+    return Serialize(Gather(World, Filter));
+}
+
+void FGeoBlueprintJsonWorldSnapshot::CaptureAsync(UWorld* World, const FGeoBlueprintJsonWorldSnapshotFilter& Filter, TFunction<void(FString&&)> OnComplete)
+{
+    TSharedRef<FGeoBlueprintJsonWorldSnapshotData> Data = Gather(World, Filter);
+    Async(EAsyncExecution::ThreadPool, [Data, OnComplete = MoveTemp(OnComplete)]() mutable
+    {
+        FString SnapshotJson = Serialize(*Data);
+        AsyncTask(ENamedThreads::GameThread, [SnapshotJson = MoveTemp(SnapshotJson), OnComplete = MoveTemp(OnComplete)]() mutable
+        {
+            OnComplete(MoveTemp(SnapshotJson));
+        });
+    });
+}
+
+FString UGeoBlueprintJsonWorldSnapshotLibrary::CaptureWorldSnapshot(const UObject* WorldContextObject, const FGeoBlueprintJsonWorldSnapshotFilter& Filter)
+{
+    UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+    if (!World)
+    {
+        return TEXT("");
+    }
+    return FGeoBlueprintJsonWorldSnapshot::Capture(World, Filter);
+}
+
+void UGeoBlueprintJsonWorldSnapshotLibrary::CaptureWorldSnapshotAsync(const UObject* WorldContextObject, const FGeoBlueprintJsonWorldSnapshotFilter& Filter, FGeoBlueprintJsonWorldSnapshotDelegate OnComplete)
+{
+    UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+    if (!World)
+    {
+        OnComplete.ExecuteIfBound(FString());
+        return;
+    }
+
+    FGeoBlueprintJsonWorldSnapshot::CaptureAsync(World, Filter, [OnComplete](FString&& SnapshotJson)
+    {
+        OnComplete.ExecuteIfBound(SnapshotJson);
+    });
+}
@@ -0,0 +1,217 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+/**
+ * Bump allocator backing the export DOM. Memory is carved out of fixed-size pages and is only
+ * ever released all at once, by Reset() or when the arena is destroyed. Nothing allocated from
+ * the arena has its destructor run, so only trivially destructible types may live in it.
+ */
+class GEOBLUEPRINTJSON_API FGeoJsonArena
+{
+public:
+    explicit FGeoJsonArena(SIZE_T InPageSize = 64 * 1024);
+    ~FGeoJsonArena();
+
+    FGeoJsonArena(const FGeoJsonArena&) = delete;
+    FGeoJsonArena& operator=(const FGeoJsonArena&) = delete;
+
+    void* Alloc(SIZE_T Size, SIZE_T Alignment);
+
+    template <typename T, typename... ArgTypes>
+    T* New(ArgTypes&&... Args)
+    {
+        static_assert(std::is_trivially_destructible_v<T>, "Arena allocated types are never destroyed");
+        return new (Alloc(sizeof(T), alignof(T))) T(Forward<ArgTypes>(Args)...);
+    }
+
+    /** Copies a string into the arena. The copy is always null terminated. */
+    FStringView CopyString(FStringView String);
+
+    /** Releases every allocation at once. The first page is kept so the arena can be reused without touching the heap. */
+    void Reset();
+
+    SIZE_T GetBytesUsed() const { return BytesUsed; }
+    SIZE_T GetBytesReserved() const { return BytesReserved; }
+
+private:
+    void AllocatePage(SIZE_T MinSize);
+
+    struct FPage
+    {
+        uint8* Memory;
+        SIZE_T Size;
+    };
+
+    TArray<FPage> Pages;
+    uint8* Cursor = nullptr;
+    uint8* End = nullptr;
+    SIZE_T PageSize;
+    SIZE_T BytesUsed = 0;
+    SIZE_T BytesReserved = 0;
+};
+
+/**
+ * Growable array whose storage lives in an arena. Growing copies into a fresh block and abandons
+ * the old one, which the arena reclaims on reset.
+ */
+template <typename T>
+struct TGeoJsonArenaArray
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Arena arrays are relocated with memcpy");
+
+    T* Data = nullptr;
+    int32 Num = 0;
+    int32 Max = 0;
+
+    T& Add(FGeoJsonArena& Arena, const T& Item)
+    {
+        if (Num == Max)
+        {
+            const int32 NewMax = Max > 0 ? Max * 2 : 8;
+            T* NewData = static_cast<T*>(Arena.Alloc(sizeof(T) * NewMax, alignof(T)));
+            if (Num > 0)
+            {
+                FMemory::Memcpy(NewData, Data, sizeof(T) * Num);
+            }
+            Data = NewData;
+            Max = NewMax;
+        }
+        Data[Num] = Item;
+        return Data[Num++];
+    }
+
+    T* begin() { return Data; }
+    T* end() { return Data + Num; }
+    const T* begin() const { return Data; }
+    const T* end() const { return Data + Num; }
+};
+
+enum class EGeoJsonType : uint8
+{
+    Null,
+    Bool,
+    Number,
+    String,
+    Array,
+    Object
+};
+
+struct FGeoJsonArray;
+struct FGeoJsonObject;
+
+/** String stored in the arena, kept as a pointer/length pair so the value stays trivially copyable */
+struct FGeoJsonStringRef
+{
+    const TCHAR* Data;
+    int32 Len;
+
+    FStringView View() const { return FStringView(Data, Len); }
+};
+
+struct GEOBLUEPRINTJSON_API FGeoJsonValue
+{
+    EGeoJsonType Type;
+    union
+    {
+        bool Bool;
+        double Number;
+        FGeoJsonStringRef String;
+        FGeoJsonArray* Array;
+        FGeoJsonObject* Object;
+    };
+
+    FGeoJsonValue() : Type(EGeoJsonType::Null), Number(0.0) {}
+
+    static FGeoJsonValue MakeBool(bool bValue) { FGeoJsonValue Value; Value.Type = EGeoJsonType::Bool; Value.Bool = bValue; return Value; }
+    static FGeoJsonValue MakeNumber(double InNumber) { FGeoJsonValue Value; Value.Type = EGeoJsonType::Number; Value.Number = InNumber; return Value; }
+    static FGeoJsonValue MakeString(FGeoJsonArena& Arena, FStringView InString);
+    static FGeoJsonValue MakeArray(FGeoJsonArray* InArray) { FGeoJsonValue Value; Value.Type = EGeoJsonType::Array; Value.Array = InArray; return Value; }
+    static FGeoJsonValue MakeObject(FGeoJsonObject* InObject) { FGeoJsonValue Value; Value.Type = EGeoJsonType::Object; Value.Object = InObject; return Value; }
+
+    /** Converts to the engine DOM, allocating shared values on the heap */
+    TSharedPtr<FJsonValue> ToJsonValue() const;
+};
+
+struct FGeoJsonField
+{
+    FGeoJsonStringRef Key;
+    FGeoJsonValue Value;
+};
+
+/**
+ * JSON array allocated from an arena. Elements are stored inline in a flat array.
+ */
+struct GEOBLUEPRINTJSON_API FGeoJsonArray
+{
+    explicit FGeoJsonArray(FGeoJsonArena& InArena) : Arena(&InArena) {}
+
+    void AddString(FStringView Value) { Values.Add(*Arena, FGeoJsonValue::MakeString(*Arena, Value)); }
+    void AddNumber(double Value) { Values.Add(*Arena, FGeoJsonValue::MakeNumber(Value)); }
+    void AddBool(bool bValue) { Values.Add(*Arena, FGeoJsonValue::MakeBool(bValue)); }
+    void AddObject(FGeoJsonObject* Object) { Values.Add(*Arena, FGeoJsonValue::MakeObject(Object)); }
+    FGeoJsonObject* AddObject();
+    FGeoJsonArray* AddArray();
+
+    int32 Num() const { return Values.Num; }
+    const FGeoJsonValue& operator[](int32 Index) const { check(Index >= 0 && Index < Values.Num); return Values.Data[Index]; }
+
+    FGeoJsonArena& GetArena() const { return *Arena; }
+
+    TArray<TSharedPtr<FJsonValue>> ToJsonValues() const;
+
+    /** Writes the array with the same formatting FJsonSerializer uses for an equivalent TArray<TSharedPtr<FJsonValue>> */
+    void Serialize(FString& OutString, bool bPrettyPrint = true) const;
+
+    /** Appends the UTF-8 encoding of what Serialize writes, escaping and transcoding in a single pass */
+    void SerializeUtf8(TArray<uint8>& OutBytes, bool bPrettyPrint = true) const;
+
+    FGeoJsonArena* Arena;
+    TGeoJsonArenaArray<FGeoJsonValue> Values;
+};
+
+/**
+ * JSON object allocated from an arena. Fields are kept in insertion order in a flat array.
+ * Unlike FJsonObject, the Set*Field helpers append without looking the key up, so each key may
+ * only be set once; use ReplaceField to overwrite a value that is already there.
+ */
+struct GEOBLUEPRINTJSON_API FGeoJsonObject
+{
+    explicit FGeoJsonObject(FGeoJsonArena& InArena) : Arena(&InArena) {}
+
+    void SetStringField(FStringView Key, FStringView Value) { SetField(Key, FGeoJsonValue::MakeString(*Arena, Value)); }
+    void SetNumberField(FStringView Key, double Value) { SetField(Key, FGeoJsonValue::MakeNumber(Value)); }
+    void SetBoolField(FStringView Key, bool bValue) { SetField(Key, FGeoJsonValue::MakeBool(bValue)); }
+    void SetNullField(FStringView Key) { SetField(Key, FGeoJsonValue()); }
+    void SetObjectField(FStringView Key, FGeoJsonObject* Object) { SetField(Key, FGeoJsonValue::MakeObject(Object)); }
+    void SetArrayField(FStringView Key, FGeoJsonArray* Array) { SetField(Key, FGeoJsonValue::MakeArray(Array)); }
+
+    /** Creates an empty child object or array and stores it under Key */
+    FGeoJsonObject* SetObjectField(FStringView Key);
+    FGeoJsonArray* SetArrayField(FStringView Key);
+
+    /** Appends a field; a duplicate key is only caught where checkSlow is enabled */
+    void SetField(FStringView Key, const FGeoJsonValue& Value);
+
+    /** Overwrites the field under Key, or appends it when there is none */
+    void ReplaceField(FStringView Key, const FGeoJsonValue& Value);
+
+    const FGeoJsonValue* FindField(FStringView Key) const;
+
+    int32 Num() const { return Fields.Num; }
+
+    FGeoJsonArena& GetArena() const { return *Arena; }
+
+    TSharedRef<FJsonObject> ToJsonObject() const;
+
+    /** Writes the object with the same formatting FJsonSerializer uses for an equivalent FJsonObject */
+    void Serialize(FString& OutString, bool bPrettyPrint = true) const;
+
+    /** Appends the UTF-8 encoding of what Serialize writes, escaping and transcoding in a single pass */
+    void SerializeUtf8(TArray<uint8>& OutBytes, bool bPrettyPrint = true) const;
+
+    FGeoJsonArena* Arena;
+    TGeoJsonArenaArray<FGeoJsonField> Fields;
+};
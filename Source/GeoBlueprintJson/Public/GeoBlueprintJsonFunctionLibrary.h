@@ -4,46 +4,7 @@
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "GeoBlueprintJsonFunctionLibrary.generated.h"
 
-// Forward declarations
-class UEdGraphPin;
-class UEdGraphNode;
-class UEdGraph;
-class UK2Node;
-class UK2Node_CallFunction;
-class UK2Node_Variable;
-class UK2Node_Event;
-class UK2Node_CustomEvent;
-class UK2Node_IfThenElse;
-class UK2Node_ExecutionSequence;
-class UK2Node_Select;
-class UBlueprint;
-
-USTRUCT()
-struct FBlueprintNodeData
-{
-    GENERATED_BODY()
-
-    UPROPERTY()
-    FString NodeName;
-
-    UPROPERTY()
-    FString NodeType;
-
-    UPROPERTY()
-    FVector2D Position;
-
-    UPROPERTY()
-    TArray<FString> InputPins;
-
-    UPROPERTY()
-    TArray<FString> OutputPins;
-
-    UPROPERTY()
-    TArray<FString> ConnectedNodes;
-
-    UPROPERTY()
-    TMap<FString, FString> NodeProperties;
-};
+struct FGeoJsonObject;
 
 UCLASS()
 class GEOBLUEPRINTJSON_API UGeoBlueprintJsonFunctionLibrary : public UBlueprintFunctionLibrary
@@ -54,39 +15,30 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
     static FString ConvertBlueprintToJson(UObject* Object);
 
+    /**
+     * Writes only the properties that differ from Baseline, which defaults to the object's archetype
+     * (its class default object, or the template it was instanced from)
+     */
     UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
-    static bool ConvertJsonToBlueprint(const FString& JsonString, UObject*& OutObject);
+    static FString ConvertBlueprintToJsonDelta(UObject* Object, UObject* Baseline = nullptr);
 
-    UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
-    static FString GetBlueprintPropertyAsJson(UObject* Object, const FString& PropertyName);
+    /** The fields of ConvertBlueprintToJsonDelta, added to an existing object. Without any baseline every field is written. */
+    static void WriteBlueprintJsonDelta(UObject* Object, UObject* Baseline, FGeoJsonObject& OutObject);
 
+    /** With bStartFromArchetype, properties missing from the JSON are reset to the archetype first, which is how deltas are applied */
     UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
-    static bool SetBlueprintPropertyFromJson(UObject* Object, const FString& PropertyName, const FString& JsonValue);
+    static bool ConvertJsonToBlueprint(const FString& JsonString, UObject*& OutObject, bool bStartFromArchetype = false);
 
+    /** Applies a UTF-8 JSON file to an object while reading it, without loading the whole file into memory */
     UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
-    static FString ConvertBlueprintGraphToJson(UBlueprint* Blueprint);
+    static bool ConvertJsonFileToBlueprint(const FString& FilePath, UObject* Object, bool bStartFromArchetype = false);
 
     UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
-    static FString ConvertBlueprintNodeToJson(UEdGraphNode* Node);
-
+    static FString GetBlueprintPropertyAsJson(UObject* Object, const FString& PropertyName);
 
-    static FString ConvertBlueprintPinToJson(UEdGraphPin* Pin);
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
+    static bool SetBlueprintPropertyFromJson(UObject* Object, const FString& PropertyName, const FString& JsonValue);
 
     UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
     static bool ExportJsonToFile(const FString& JsonString, const FString& FilePath);
-
-	UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
-	static FString ExportAllAvailableNodesAsJson();
-
-private:
-    static TSharedPtr<FJsonObject> ConvertNodeToJsonObject(UEdGraphNode* Node);
-    static TSharedPtr<FJsonObject> ConvertPinToJsonObject(UEdGraphPin* Pin);
-    static TSharedPtr<FJsonObject> ConvertConnectionToJsonObject(UEdGraphPin* Pin);
-    static TSharedPtr<FJsonObject> ConvertFunctionCallNodeToJsonObject(UK2Node_CallFunction* Node);
-    static TSharedPtr<FJsonObject> ConvertVariableNodeToJsonObject(UK2Node_Variable* Node);
-    static TSharedPtr<FJsonObject> ConvertEventNodeToJsonObject(UK2Node_Event* Node);
-    static TSharedPtr<FJsonObject> ConvertCustomEventNodeToJsonObject(UK2Node_CustomEvent* Node);
-    static TSharedPtr<FJsonObject> ConvertIfThenElseNodeToJsonObject(UK2Node_IfThenElse* Node);
-    static TSharedPtr<FJsonObject> ConvertSequenceNodeToJsonObject(UK2Node_ExecutionSequence* Node);
-    static TSharedPtr<FJsonObject> ConvertSelectNodeToJsonObject(UK2Node_Select* Node);
-}; 
\ No newline at end of file
+};
\ No newline at end of file
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IFileHandle;
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * Sidecar index of a JSON Lines export. Every record of the .jsonl file is keyed by its asset
+ * path and graph name (empty for the Blueprint record of an asset) and points at the record's
+ * byte range, together with a hash of those bytes.
+ *
+ * File layout, little endian:
+ *   FGeoBlueprintJsonIndexHeader
+ *   FGeoBlueprintJsonIndexEntry[NumEntries], sorted by KeyHash
+ *   String pool of UTF-8 keys, each "<AssetPath>\n<GraphName>"
+ */
+struct FGeoBlueprintJsonIndexHeader
+{
+    static constexpr uint32 ExpectedMagic = 0x494A4247; // "GBJI"
+    static constexpr uint32 CurrentVersion = 1;
+
+    uint32 Magic = ExpectedMagic;
+    uint32 Version = CurrentVersion;
+    uint32 NumEntries = 0;
+    uint32 Reserved = 0;
+    uint64 StringPoolOffset = 0;
+    uint64 StringPoolSize = 0;
+};
+static_assert(sizeof(FGeoBlueprintJsonIndexHeader) == 32, "The index header is part of the file format");
+
+struct FGeoBlueprintJsonIndexEntry
+{
+    uint64 KeyHash = 0;
+    uint64 ContentHash = 0;
+
+    /** Byte range of the record in the .jsonl file, excluding the line terminator */
+    uint64 Offset = 0;
+    uint32 Length = 0;
+
+    /** Byte range of the key in the string pool */
+    uint32 KeyOffset = 0;
+    uint32 KeyLength = 0;
+    uint32 Reserved = 0;
+};
+static_assert(sizeof(FGeoBlueprintJsonIndexEntry) == 40, "Index entries are part of the file format");
+
+class GEOBLUEPRINTJSON_API FGeoBlueprintJsonIndexWriter
+{
+public:
+    /** Registers a record written at Offset of the .jsonl file */
+    void Add(FStringView AssetPath, FStringView GraphName, uint64 Offset, const void* RecordData, uint32 Length);
+
+    /** Registers a record whose key and hash are already known, e.g. when merging indices */
+    void AddEntry(const FString& Key, uint64 ContentHash, uint64 Offset, uint32 Length);
+
+    bool Save(const FString& IndexPath);
+
+    int32 Num() const { return Entries.Num(); }
+
+    static FString MakeKey(FStringView AssetPath, FStringView GraphName);
+    static uint64 HashBytes(const void* Data, uint64 Length);
+
+private:
+    TArray<FGeoBlueprintJsonIndexEntry> Entries;
+    TArray<uint8> StringPool;
+};
+
+/**
+ * Looks up single records of a JSON Lines export through its sidecar index. Both files are memory
+ * mapped, so a lookup is a binary search over the mapped entries and the returned record is a view
+ * of the mapped export; nothing else in the file is read. Platforms without mapped files fall back
+ * to reading the index into memory and each record with a seek.
+ *
+ * A reader is meant to be used from one thread at a time.
+ */
+class GEOBLUEPRINTJSON_API FGeoBlueprintJsonIndexReader
+{
+public:
+    FGeoBlueprintJsonIndexReader();
+    ~FGeoBlueprintJsonIndexReader();
+
+    /** Opens an export and its index, which defaults to GetIndexPath(JsonLinesPath) */
+    bool Open(const FString& JsonLinesPath, const FString& IndexPath = FString());
+    void Close();
+    bool IsOpen() const { return Entries != nullptr; }
+
+    const FGeoBlueprintJsonIndexEntry* Find(FStringView AssetPath, FStringView GraphName) const;
+
+    /** The record bytes inside the mapped export, valid until Close(). Empty when the export isn't mapped. */
+    TConstArrayView<uint8> GetRecordView(const FGeoBlueprintJsonIndexEntry& Entry) const;
+
+    /** Copies a record out of the export, mapped or not */
+    bool ReadRecord(const FGeoBlueprintJsonIndexEntry& Entry, FString& OutJson) const;
+    bool ReadRecord(FStringView AssetPath, FStringView GraphName, FString& OutJson) const;
+
+    TConstArrayView<FGeoBlueprintJsonIndexEntry> GetEntries() const;
+    FString GetKey(const FGeoBlueprintJsonIndexEntry& Entry) const;
+
+    static FString GetIndexPath(const FString& JsonLinesPath) { return JsonLinesPath + TEXT(".idx"); }
+
+private:
+    bool MapOrLoadIndex(const FString& IndexPath);
+    bool MatchesKey(const FGeoBlueprintJsonIndexEntry& Entry, const uint8* Key, int32 KeyLength) const;
+
+    TUniquePtr<IMappedFileHandle> IndexHandle;
+    TUniquePtr<IMappedFileRegion> IndexRegion;
+    TArray<uint8> IndexData;
+
+    TUniquePtr<IMappedFileHandle> DataHandle;
+    TUniquePtr<IMappedFileRegion> DataRegion;
+    TUniquePtr<IFileHandle> DataFile;
+
+    const FGeoBlueprintJsonIndexEntry* Entries = nullptr;
+    int32 NumEntries = 0;
+    const uint8* StringPool = nullptr;
+    uint64 StringPoolSize = 0;
+    const uint8* MappedData = nullptr;
+    uint64 DataSize = 0;
+};
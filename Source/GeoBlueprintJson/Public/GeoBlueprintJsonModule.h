@@ -8,4 +8,10 @@ class FGeoBlueprintJsonModule : public IModuleInterface
 public:
     virtual void StartupModule() override;
     virtual void ShutdownModule() override;
+
+private:
+    void WriteSessionProfile();
+
+    FString ProfileOutputFile;
+    FDelegateHandle PreExitHandle;
 }; 
\ No newline at end of file
@@ -0,0 +1,158 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "UObject/WeakObjectPtr.h"
+#include "GeoBlueprintJsonScriptProfiler.generated.h"
+
+struct FBlueprintContextTracker;
+struct FBlueprintExceptionInfo;
+struct FFrame;
+struct FScriptInstrumentationSignal;
+
+struct FGeoBlueprintJsonHeat
+{
+    int64 HitCount = 0;
+    double TimeMs = 0.0;
+};
+
+/** Heat keyed by "<Blueprint path>:<NodeGuid>" for nodes and "<Blueprint path>:<Function name>" for functions */
+using FGeoBlueprintJsonHeatMap = TMap<FString, FGeoBlueprintJsonHeat>;
+
+/**
+ * Captures Blueprint execution counts and inclusive times at runtime.
+ *
+ * Function calls are timed through the Blueprint context tracker. Node hits come from script
+ * instrumentation events when the bytecode was compiled with instrumentation, and from the debug
+ * tracepoints the editor compiles into every Blueprint otherwise. Hits are recorded against raw
+ * code offsets and only mapped back to node GUIDs when the capture is dumped.
+ *
+ * Only game thread execution is recorded.
+ */
+class GEOBLUEPRINTJSON_API FGeoBlueprintJsonScriptProfiler
+{
+public:
+    static FGeoBlueprintJsonScriptProfiler& Get();
+
+    void Start();
+    void Stop();
+    void Reset();
+    bool IsRunning() const { return bRunning; }
+    bool HasSamples() const { return FunctionStats.Num() > 0 || NodeStats.Num() > 0; }
+
+    /** Writes the capture as JSON. Nodes are identified by Blueprint path and NodeGuid where debug data allows it. */
+    FString DumpToJson() const;
+    bool DumpToFile(const FString& FilePath) const;
+
+    /** Resolves the live capture into the heat map graph exports are annotated with */
+    void BuildHeatMap(FGeoBlueprintJsonHeatMap& OutHeatMap) const;
+
+    /**
+     * BuildHeatMap shared between callers and only rebuilt when the capture has changed. While a capture
+     * is recording, a rebuild happens at most every HeatMapRefreshSeconds. Game thread only.
+     */
+    TSharedRef<const FGeoBlueprintJsonHeatMap> GetHeatMap();
+
+    /** Bumped whenever samples are recorded or the capture is reset */
+    uint64 GetCaptureVersion() const { return CaptureVersion; }
+
+    /** Reads the heat map back from a file written by DumpToFile */
+    static bool LoadHeatMap(const FString& FilePath, FGeoBlueprintJsonHeatMap& OutHeatMap);
+
+    /** LoadHeatMap shared between callers and only read again when the file's timestamp changes. Game thread only. */
+    static TSharedRef<const FGeoBlueprintJsonHeatMap> GetFileHeatMap(const FString& FilePath);
+
+    static constexpr double HeatMapRefreshSeconds = 1.0;
+
+    static FString MakeHeatKey(const FString& BlueprintPath, const FString& Name);
+
+private:
+    struct FNodeKey
+    {
+        TWeakObjectPtr<UFunction> Function;
+        int32 CodeOffset = INDEX_NONE;
+
+        bool operator==(const FNodeKey& Other) const
+        {
+            return Function == Other.Function && CodeOffset == Other.CodeOffset;
+        }
+
+        friend uint32 GetTypeHash(const FNodeKey& Key)
+        {
+            return HashCombine(GetTypeHash(Key.Function), ::GetTypeHash(Key.CodeOffset));
+        }
+    };
+
+    struct FExecutionStats
+    {
+        int64 Count = 0;
+        double Seconds = 0.0;
+    };
+
+    struct FResolvedStats
+    {
+        FString BlueprintPath;
+        FString Name;
+        FExecutionStats Stats;
+    };
+
+    struct FContextFrame
+    {
+        TWeakObjectPtr<UFunction> Function;
+        double StartTime = 0.0;
+        FNodeKey CurrentNode;
+        double NodeStartTime = 0.0;
+        bool bHasNode = false;
+    };
+
+    void OnEnterScriptContext(const FBlueprintContextTracker& Tracker, const UObject* ContextObject, const UFunction* Function);
+    void OnExitScriptContext(const FBlueprintContextTracker& Tracker);
+    void OnScriptException(const UObject* ActiveObject, const FFrame& StackFrame, const FBlueprintExceptionInfo& Info);
+    void OnScriptProfilingEvent(const FScriptInstrumentationSignal& Signal);
+
+    /** Maps raw samples back to Blueprint paths, function names and node GUIDs, merging samples that land on the same node */
+    void ResolveFunctions(TArray<FResolvedStats>& OutFunctions) const;
+    void ResolveNodes(TArray<FResolvedStats>& OutNodes) const;
+
+    void RecordNodeSite(UFunction* Function, int32 CodeOffset);
+    void CloseCurrentNode(FContextFrame& Frame, double Now);
+
+    TMap<TWeakObjectPtr<UFunction>, FExecutionStats> FunctionStats;
+    TMap<FNodeKey, FExecutionStats> NodeStats;
+    TArray<FContextFrame> ContextStack;
+
+    FDelegateHandle EnterContextHandle;
+    FDelegateHandle ExitContextHandle;
+    FDelegateHandle ScriptExceptionHandle;
+    FDelegateHandle ProfilingEventHandle;
+
+    uint64 CaptureVersion = 0;
+    TSharedPtr<const FGeoBlueprintJsonHeatMap> CachedHeatMap;
+    uint64 CachedHeatMapVersion = 0;
+    double CachedHeatMapTime = 0.0;
+
+    double CaptureStartTime = 0.0;
+    double CapturedSeconds = 0.0;
+    bool bRunning = false;
+    bool bReceivedInstrumentation = false;
+};
+
+UCLASS()
+class GEOBLUEPRINTJSON_API UGeoBlueprintJsonScriptProfilerLibrary : public UBlueprintFunctionLibrary
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON|Profiling")
+    static void StartBlueprintProfiling();
+
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON|Profiling")
+    static void StopBlueprintProfiling();
+
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON|Profiling")
+    static void ResetBlueprintProfiling();
+
+    /** Writes the current capture to a file that graph exports can merge through FGeoBlueprintJsonGraphExportOptions::HeatProfileFile */
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON|Profiling")
+    static bool DumpBlueprintProfile(const FString& FilePath);
+};
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "Templates/SubclassOf.h"
+#include "GeoBlueprintJsonWorldSnapshot.generated.h"
+
+USTRUCT(BlueprintType)
+struct FGeoBlueprintJsonWorldSnapshotFilter
+{
+    GENERATED_BODY()
+
+    /** Only actors of these classes are captured. Empty captures every actor. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geo|JSON")
+    TArray<TSubclassOf<AActor>> ActorClasses;
+
+    /** Only actors carrying at least one of these tags are captured. Empty ignores tags. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geo|JSON")
+    TArray<FName> ActorTags;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geo|JSON")
+    bool bIncludeComponents = true;
+
+    /**
+     * How many object references are followed away from the captured actors and components.
+     * Objects further away are written as references only, with their path and class.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geo|JSON")
+    int32 MaxReferenceDepth = 1;
+};
+
+DECLARE_DYNAMIC_DELEGATE_OneParam(FGeoBlueprintJsonWorldSnapshotDelegate, const FString&, SnapshotJson);
+
+class FGeoBlueprintJsonWorldSnapshotData;
+
+/**
+ * Captures many live actors into one JSON document. Property values of every matching actor, its
+ * components and the objects they reference are copied out in a single game thread pass; the
+ * document is then written on worker threads from those copies without touching the objects again.
+ * Every object appears once in the "Objects" array, and object properties refer to it by id.
+ */
+class GEOBLUEPRINTJSON_API FGeoBlueprintJsonWorldSnapshot
+{
+public:
+    /** Gathers and serializes on the calling thread, spreading serialization across workers */
+    static FString Capture(UWorld* World, const FGeoBlueprintJsonWorldSnapshotFilter& Filter);
+
+    /** Gathers on the game thread and calls OnComplete back on the game thread once the document is written */
+    static void CaptureAsync(UWorld* World, const FGeoBlueprintJsonWorldSnapshotFilter& Filter, TFunction<void(FString&&)> OnComplete);
+
+    /** The game thread part of a capture */
+    static TSharedRef<FGeoBlueprintJsonWorldSnapshotData> Gather(UWorld* World, const FGeoBlueprintJsonWorldSnapshotFilter& Filter);
+
+    /** The thread-safe part of a capture */
+    static FString Serialize(const FGeoBlueprintJsonWorldSnapshotData& Data);
+};
+
+UCLASS()
+class GEOBLUEPRINTJSON_API UGeoBlueprintJsonWorldSnapshotLibrary : public UBlueprintFunctionLibrary
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON", meta = (WorldContext = "WorldContextObject"))
+    static FString CaptureWorldSnapshot(const UObject* WorldContextObject, const FGeoBlueprintJsonWorldSnapshotFilter& Filter);
+
+    /** Only the gather runs on the game thread; OnComplete fires on a later frame */
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON", meta = (WorldContext = "WorldContextObject"))
+    static void CaptureWorldSnapshotAsync(const UObject* WorldContextObject, const FGeoBlueprintJsonWorldSnapshotFilter& Filter, FGeoBlueprintJsonWorldSnapshotDelegate OnComplete);
+};
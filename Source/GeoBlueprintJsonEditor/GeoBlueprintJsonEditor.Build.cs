@@ -0,0 +1,39 @@
+using UnrealBuildTool;
+
+public class GeoBlueprintJsonEditor : ModuleRules
+{
+    public GeoBlueprintJsonEditor(ReadOnlyTargetRules Target) : base(Target)
+    {
+        PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+        PublicDependencyModuleNames.AddRange(
+            new string[]
+            {
+                "Core",
+                "CoreUObject",
+                "Engine",
+                "Json",
+                "JsonUtilities",
+                "BlueprintGraph",
+                "GeoBlueprintJson"
+            }
+        );
+
+        PrivateDependencyModuleNames.AddRange(
+            new string[]
+            {
+                "AnimGraph",
+                "AssetRegistry",
+                "Slate",
+                "SlateCore",
+                "GraphEditor",
+                "KismetCompiler",
+                "Networking",
+                "Sockets",
+                "UMG",
+                "UMGEditor",
+                "UnrealEd"
+            }
+        );
+    }
+}
@@ -0,0 +1,297 @@
+#include "GeoBlueprintJsonAnimAnalysis.h"
+#include "AnimGraphNode_Base.h"
+#include "AnimStateNodeBase.h"
+#include "AnimStateTransitionNode.h"
+#include "AnimationConduitGraph.h"
+#include "AnimationCustomTransitionGraph.h"
+#include "AnimationGraph.h"
+#include "AnimationGraphSchema.h"
+#include "AnimationStateGraph.h"
+#include "AnimationStateMachineGraph.h"
+#include "AnimationTransitionGraph.h"
+#include "Animation/AnimBlueprint.h"
+#include "Animation/AnimInstance.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphPin.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Event.h"
+#include "K2Node_Knot.h"
+#include "K2Node_StructMemberGet.h"
+#include "K2Node_TransitionRuleGetter.h"
+#include "K2Node_VariableGet.h"
+#include "Kismet/KismetMathLibrary.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+
+namespace GeoBlueprintJsonAnimAnalysis
+{
+    /** Reroutes and struct breaks rarely nest deeper; anything that does is treated as Blueprint logic */
+    static constexpr int32 MaxSourceDepth = 16;
+
+    static bool IsFastPathSource(const UEdGraphPin* SourcePin, int32 Depth);
+
+    static bool IsFastPathInput(const UEdGraphPin* InputPin, int32 Depth)
+    {
+        return InputPin && InputPin->LinkedTo.Num() == 1 && IsFastPathSource(InputPin->LinkedTo[0], Depth + 1);
+    }
+
+    static bool IsFastPathSource(const UEdGraphPin* SourcePin, int32 Depth)
+    {
+        const UEdGraphNode* Node = SourcePin && Depth <= MaxSourceDepth ? SourcePin->GetOwningNodeUnchecked() : nullptr;
+        if (!Node)
+        {
+            return false;
+        }
+
+        if (const UK2Node_Knot* Knot = Cast<UK2Node_Knot>(Node))
+        {
+            return IsFastPathInput(Knot->GetInputPin(), Depth);
+        }
+
+        // Members of this instance only; reading through another object's pointer needs the VM
+        if (const UK2Node_VariableGet* VariableGet = Cast<UK2Node_VariableGet>(Node))
+        {
+            const UEdGraphPin* SelfPin = VariableGet->FindPin(UEdGraphSchema_K2::PN_Self);
+            return VariableGet->IsNodePure() && VariableGet->VariableReference.IsSelfContext() && !(SelfPin && SelfPin->LinkedTo.Num() > 0);
+        }
+
+        // Break Struct and struct member gets copy a sub-property of whatever feeds their one input
+        if (Node->IsA<UK2Node_StructMemberGet>())
+        {
+            for (const UEdGraphPin* Pin : Node->Pins)
+            {
+                if (Pin && Pin->Direction == EGPD_Input)
+                {
+                    return IsFastPathInput(Pin, Depth);
+                }
+            }
+            return false;
+        }
+
+        if (const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+        {
+            const UFunction* Function = CallNode->GetTargetFunction();
+            const bool bNot = Function && Function->GetOwnerClass() == UKismetMathLibrary::StaticClass()
+                && Function->GetFName() == GET_FUNCTION_NAME_CHECKED(UKismetMathLibrary, Not_PreBool);
+            return bNot && IsFastPathInput(CallNode->FindPin(TEXT("A")), Depth);
+        }
+
+        if (Node->IsA<UK2Node_TransitionRuleGetter>())
+        {
+            return true;
+        }
+
+        // Property access nodes live in a plugin this module doesn't depend on
+        return Node->GetClass()->GetFName() == TEXT("K2Node_PropertyAccess");
+    }
+
+    static const TCHAR* GetNestedGraphType(const UEdGraph* Graph)
+    {
+        if (Graph->IsA<UAnimationStateMachineGraph>())
+        {
+            return TEXT("StateMachine");
+        }
+        // Conduits are transition graphs, so they are checked first
+        if (Graph->IsA<UAnimationConduitGraph>())
+        {
+            return TEXT("Conduit");
+        }
+        if (Graph->IsA<UAnimationTransitionGraph>())
+        {
+            return TEXT("Transition");
+        }
+        if (Graph->IsA<UAnimationCustomTransitionGraph>())
+        {
+            return TEXT("CustomTransition");
+        }
+        if (Graph->IsA<UAnimationStateGraph>())
+        {
+            return TEXT("State");
+        }
+        return TEXT("Subgraph");
+    }
+
+    static void VisitNestedGraphs(const UEdGraph* Graph, TSet<const UEdGraph*>& Visited, TFunctionRef<void(UEdGraph*, const TCHAR*)> Callback)
+    {
+        for (const UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (!Node)
+            {
+                continue;
+            }
+
+            for (UEdGraph* SubGraph : Node->GetSubGraphs())
+            {
+                bool bAlreadyVisited = false;
+                Visited.Add(SubGraph, &bAlreadyVisited);
+                if (SubGraph && !bAlreadyVisited)
+                {
+                    Callback(SubGraph, GetNestedGraphType(SubGraph));
+                    VisitNestedGraphs(SubGraph, Visited, Callback);
+                }
+            }
+        }
+    }
+}
+
+bool FGeoBlueprintJsonAnimAnalysis::IsFastPathSource(const UEdGraphPin* SourcePin)
+{
+    return GeoBlueprintJsonAnimAnalysis::IsFastPathSource(SourcePin, 0);
+}
+
+FGeoBlueprintJsonAnimNodeReport FGeoBlueprintJsonAnimAnalysis::AnalyzeNode(const UAnimGraphNode_Base* Node)
+{
+    FGeoBlueprintJsonAnimNodeReport Report;
+    Report.Node = Node;
+    if (!Node)
+    {
+        return Report;
+    }
+
+    // Poses are evaluated by the graph itself; every other linked input is copied before the node updates
+    for (const UEdGraphPin* Pin : Node->Pins)
+    {
+        if (!Pin || Pin->Direction != EGPD_Input || Pin->LinkedTo.Num() == 0 || UAnimationGraphSchema::IsPosePin(Pin->PinType))
+        {
+            continue;
+        }
+
+        if (IsFastPathSource(Pin->LinkedTo[0]))
+        {
+            ++Report.NumFastPathPins;
+        }
+        else
+        {
+            Report.SlowPathPins.Add(Pin->PinName);
+        }
+    }
+    return Report;
+}
+
+FGeoBlueprintJsonAnimFunctionReport FGeoBlueprintJsonAnimAnalysis::AnalyzeFunction(const UBlueprint* Blueprint, const UEdGraph* FunctionGraph)
+{
+    FGeoBlueprintJsonAnimFunctionReport Report;
+    Report.Graph = FunctionGraph;
+    if (!Blueprint || !FunctionGraph)
+    {
+        return Report;
+    }
+
+    // The skeleton class is regenerated on load, so this works on Blueprints that were never compiled in this session
+    const UClass* SkeletonClass = Blueprint->SkeletonGeneratedClass;
+    const UFunction* Function = SkeletonClass ? SkeletonClass->FindFunctionByName(FunctionGraph->GetFName()) : nullptr;
+    Report.bThreadSafe = Function && FBlueprintEditorUtils::HasFunctionBlueprintThreadSafeMetaData(Function);
+
+    for (const UEdGraphNode* Node : FunctionGraph->Nodes)
+    {
+        const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node);
+        const UFunction* TargetFunction = CallNode ? CallNode->GetTargetFunction() : nullptr;
+        if (TargetFunction && !FBlueprintEditorUtils::HasFunctionBlueprintThreadSafeMetaData(TargetFunction))
+        {
+            Report.UnsafeCalls.AddUnique(TargetFunction->GetFName());
+        }
+    }
+    return Report;
+}
+
+FGeoBlueprintJsonAnimBlueprintReport FGeoBlueprintJsonAnimAnalysis::AnalyzeBlueprint(const UBlueprint* Blueprint)
+{
+    FGeoBlueprintJsonAnimBlueprintReport Report;
+    const UAnimBlueprint* AnimBlueprint = Cast<UAnimBlueprint>(Blueprint);
+    if (!AnimBlueprint)
+    {
+        return Report;
+    }
+
+    Report.bIsAnimBlueprint = true;
+    Report.bUseMultiThreadedAnimationUpdate = AnimBlueprint->bUseMultiThreadedAnimationUpdate;
+
+    auto AnalyzeAnimGraph = [&Report](const UEdGraph* Graph)
+    {
+        for (const UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (const UAnimGraphNode_Base* AnimNode = Cast<UAnimGraphNode_Base>(Node))
+            {
+                FGeoBlueprintJsonAnimNodeReport NodeReport = AnalyzeNode(AnimNode);
+                Report.NumFastPathNodes += NodeReport.IsFastPath() ? 1 : 0;
+                Report.NumSlowPathNodes += NodeReport.IsFastPath() ? 0 : 1;
+                Report.Nodes.Add(MoveTemp(NodeReport));
+            }
+            else if (Node && Node->IsA<UAnimStateTransitionNode>())
+            {
+                ++Report.NumTransitions;
+            }
+            else if (Node && Node->IsA<UAnimStateNodeBase>())
+            {
+                ++Report.NumStates;
+            }
+        }
+    };
+
+    // An update event with nothing connected is skipped by the compiler, so only a wired one counts
+    for (const UEdGraph* Graph : AnimBlueprint->UbergraphPages)
+    {
+        if (!Graph)
+        {
+            continue;
+        }
+
+        for (const UEdGraphNode* Node : Graph->Nodes)
+        {
+            const UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node);
+            if (EventNode && EventNode->EventReference.GetMemberName() == GET_FUNCTION_NAME_CHECKED(UAnimInstance, BlueprintUpdateAnimation))
+            {
+                const UEdGraphPin* ThenPin = EventNode->FindPin(UEdGraphSchema_K2::PN_Then);
+                Report.bUsesUpdateAnimationEvent |= ThenPin && ThenPin->LinkedTo.Num() > 0;
+            }
+        }
+    }
+
+    // Anim graphs and anim layers are function graphs too, but they are evaluated as anim nodes rather than called
+    for (const UEdGraph* Graph : AnimBlueprint->FunctionGraphs)
+    {
+        if (!Graph)
+        {
+            continue;
+        }
+        if (Graph->IsA<UAnimationGraph>())
+        {
+            AnalyzeAnimGraph(Graph);
+            continue;
+        }
+
+        FGeoBlueprintJsonAnimFunctionReport FunctionReport = AnalyzeFunction(AnimBlueprint, Graph);
+        Report.bUsesThreadSafeUpdateAnimation |= Graph->GetFName() == GET_FUNCTION_NAME_CHECKED(UAnimInstance, BlueprintThreadSafeUpdateAnimation);
+        Report.NumThreadSafeFunctions += FunctionReport.bThreadSafe ? 1 : 0;
+        Report.NumThreadSafetyViolations += FunctionReport.bThreadSafe && FunctionReport.UnsafeCalls.Num() > 0 ? 1 : 0;
+        Report.Functions.Add(MoveTemp(FunctionReport));
+    }
+
+    ForEachNestedGraph(AnimBlueprint, [&Report, &AnalyzeAnimGraph](UEdGraph* Graph, const TCHAR* GraphType)
+    {
+        Report.NumStateMachines += Graph->IsA<UAnimationStateMachineGraph>() ? 1 : 0;
+        AnalyzeAnimGraph(Graph);
+    });
+
+    return Report;
+}
+
+void FGeoBlueprintJsonAnimAnalysis::ForEachNestedGraph(const UBlueprint* Blueprint, TFunctionRef<void(UEdGraph*, const TCHAR*)> Callback)
+{
+    if (!Cast<UAnimBlueprint>(Blueprint))
+    {
+        return;
+    }
+
+    TSet<const UEdGraph*> Visited;
+    for (const TArray<TObjectPtr<UEdGraph>>* Graphs : { &Blueprint->UbergraphPages, &Blueprint->FunctionGraphs })
+    {
+        for (const UEdGraph* Graph : *Graphs)
+        {
+            if (Graph)
+            {
+                GeoBlueprintJsonAnimAnalysis::VisitNestedGraphs(Graph, Visited, Callback);
+            }
+        }
+    }
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UAnimGraphNode_Base;
+class UBlueprint;
+class UEdGraph;
+class UEdGraphPin;
+
+/** How one anim graph node reads its inputs */
+struct FGeoBlueprintJsonAnimNodeReport
+{
+    const UAnimGraphNode_Base* Node = nullptr;
+
+    /** Linked inputs that are copied straight from a member, a struct member or a property access */
+    int32 NumFastPathPins = 0;
+
+    /** Linked inputs computed by Blueprint logic, so the node runs the VM every update to read them */
+    TArray<FName> SlowPathPins;
+
+    bool IsFastPath() const { return SlowPathPins.Num() == 0; }
+};
+
+/** Whether a function may run on a worker thread during a multi-threaded animation update */
+struct FGeoBlueprintJsonAnimFunctionReport
+{
+    const UEdGraph* Graph = nullptr;
+
+    /** Marked BlueprintThreadSafe on the function or its class */
+    bool bThreadSafe = false;
+
+    /** Functions called from the graph that aren't thread-safe */
+    TArray<FName> UnsafeCalls;
+};
+
+/** Fast-path and thread-safety audit of one Animation Blueprint */
+struct FGeoBlueprintJsonAnimBlueprintReport
+{
+    /** False for other Blueprints; everything else is then left empty */
+    bool bIsAnimBlueprint = false;
+
+    bool bUseMultiThreadedAnimationUpdate = false;
+
+    /** BlueprintUpdateAnimation is implemented, which always runs on the game thread */
+    bool bUsesUpdateAnimationEvent = false;
+    bool bUsesThreadSafeUpdateAnimation = false;
+
+    TArray<FGeoBlueprintJsonAnimNodeReport> Nodes;
+    TArray<FGeoBlueprintJsonAnimFunctionReport> Functions;
+
+    int32 NumStateMachines = 0;
+    int32 NumStates = 0;
+    int32 NumTransitions = 0;
+    int32 NumFastPathNodes = 0;
+    int32 NumSlowPathNodes = 0;
+    int32 NumThreadSafeFunctions = 0;
+
+    /** Thread-safe functions that call something that isn't */
+    int32 NumThreadSafetyViolations = 0;
+};
+
+/**
+ * Reads an Animation Blueprint's anim graphs, state machines and functions without compiling it.
+ *
+ * An input pin is on the fast path when it is unlinked, or when it is linked (through reroutes) to a
+ * member variable get, a break of a struct that is itself on the fast path, a boolean Not of a fast
+ * path value, a transition rule getter or a property access node. Anything else is evaluated through
+ * the Blueprint VM, which is what the compiler's fast path warning reports.
+ */
+class FGeoBlueprintJsonAnimAnalysis
+{
+public:
+    static FGeoBlueprintJsonAnimBlueprintReport AnalyzeBlueprint(const UBlueprint* Blueprint);
+
+    static FGeoBlueprintJsonAnimNodeReport AnalyzeNode(const UAnimGraphNode_Base* Node);
+    static FGeoBlueprintJsonAnimFunctionReport AnalyzeFunction(const UBlueprint* Blueprint, const UEdGraph* FunctionGraph);
+
+    /** Whether a value read from the output pin can be copied without running the VM */
+    static bool IsFastPathSource(const UEdGraphPin* SourcePin);
+
+    /**
+     * Visits the graphs nested in an Animation Blueprint's graphs: state machines, states,
+     * transitions, conduits and collapsed graphs, each before the graphs nested in it
+     */
+    static void ForEachNestedGraph(const UBlueprint* Blueprint, TFunctionRef<void(UEdGraph*, const TCHAR*)> Callback);
+};
@@ -0,0 +1,29 @@
+#include "GeoBlueprintJsonBulkExport.h"
+#include "GeoBlueprintJsonBulkExporter.h"
+#include "GeoBlueprintJsonShardCoordinator.h"
+
+FGeoBlueprintJsonBulkExportResult UGeoBlueprintJsonBulkExportLibrary::ExportBlueprintsWithMemoryBudget(const FGeoBlueprintJsonBulkExportSettings& Settings)
+{
+    if (Settings.OutputDirectory.IsEmpty())
+    {
+        return FGeoBlueprintJsonBulkExportResult();
+    }
+
+    const TArray<FAssetData> Assets = FGeoBlueprintJsonBulkExporter::GatherBlueprintAssets(Settings);
+
+    FGeoBlueprintJsonBulkExporter Exporter(Settings);
+    return Exporter.Run(Assets);
+}
+
+FGeoBlueprintJsonBulkExportResult UGeoBlueprintJsonBulkExportLibrary::ExportBlueprintsSharded(const FGeoBlueprintJsonBulkExportSettings& Settings, int32 NumShards, int32 MaxRetriesPerShard)
+{
+    if (Settings.OutputDirectory.IsEmpty())
+    {
+        return FGeoBlueprintJsonBulkExportResult();
+    }
+
+    const TArray<FAssetData> Assets = FGeoBlueprintJsonBulkExporter::GatherBlueprintAssets(Settings);
+
+    FGeoBlueprintJsonShardCoordinator Coordinator(Settings, NumShards, MaxRetriesPerShard);
+    return Coordinator.Run(Assets);
+}
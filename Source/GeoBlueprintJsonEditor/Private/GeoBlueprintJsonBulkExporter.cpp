@@ -0,0 +1,461 @@
+#include "GeoBlueprintJsonBulkExporter.h"
+#include "GeoBlueprintJsonGraphExporter.h"
+#include "Async/Async.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Blueprint.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/Package.h"
+
+FGeoBlueprintJsonBulkExporter::FGeoBlueprintJsonBulkExporter(const FGeoBlueprintJsonBulkExportSettings& InSettings)
+    : Settings(InSettings)
+{
+    if (Settings.MemoryBudgetMB > 0)
+    {
+        MemoryBudgetBytes = static_cast<uint64>(Settings.MemoryBudgetMB) * 1024 * 1024;
+    }
+    else
+    {
+        MemoryBudgetBytes = FPlatformMemory::GetConstants().TotalPhysical / 4 * 3;
+    }
+}
+
+FGeoBlueprintJsonBulkExporter::~FGeoBlueprintJsonBulkExporter()
+{
+}
+
+TArray<FAssetData> FGeoBlueprintJsonBulkExporter::GatherBlueprintAssets(const FGeoBlueprintJsonBulkExportSettings& Settings)
+{
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+    if (AssetRegistry.IsLoadingAssets())
+    {
+        AssetRegistry.SearchAllAssets(true);
+    }
+
+    FARFilter Filter;
+    Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+    Filter.bRecursiveClasses = true;
+    Filter.bRecursivePaths = Settings.bRecursivePaths;
+    for (const FString& PackagePath : Settings.PackagePaths)
+    {
+        Filter.PackagePaths.Add(FName(*PackagePath));
+    }
+
+    TArray<FAssetData> Assets;
+    AssetRegistry.GetAssets(Filter, Assets);
+
+    // A stable order keeps manifests comparable between runs
+    Assets.Sort([](const FAssetData& A, const FAssetData& B)
+    {
+        return A.PackageName.LexicalLess(B.PackageName);
+    });
+    return Assets;
+}
+
+TArray<FAssetData> FGeoBlueprintJsonBulkExporter::GatherBlueprintAssets(const TArray<FName>& PackageNames)
+{
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+    if (AssetRegistry.IsLoadingAssets())
+    {
+        AssetRegistry.SearchAllAssets(true);
+    }
+
+    TArray<FAssetData> Assets;
+    TArray<FAssetData> PackageAssets;
+    for (const FName PackageName : PackageNames)
+    {
+        PackageAssets.Reset();
+        AssetRegistry.GetAssetsByPackageName(PackageName, PackageAssets);
+        for (const FAssetData& AssetData : PackageAssets)
+        {
+            if (AssetData.IsInstanceOf(UBlueprint::StaticClass()))
+            {
+                Assets.Add(AssetData);
+            }
+        }
+    }
+
+    Assets.Sort([](const FAssetData& A, const FAssetData& B)
+    {
+        return A.PackageName.LexicalLess(B.PackageName);
+    });
+    return Assets;
+}
+
+FGeoBlueprintJsonBulkExportResult FGeoBlueprintJsonBulkExporter::Run(const TArray<FAssetData>& InAssets)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    TArray<FAssetData> Assets = InAssets;
+    InheritanceCache.Reset();
+    if (Settings.bShareInheritedData)
+    {
+        FGeoBlueprintJsonInheritanceCache::SortParentFirst(Assets);
+    }
+
+    Result.ManifestPath = FPaths::Combine(Settings.OutputDirectory, TEXT("Manifest.jsonl"));
+    ManifestWriter.Reset(IFileManager::Get().CreateFileWriter(*Result.ManifestPath));
+    if (!ManifestWriter)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Bulk export could not open manifest %s"), *Result.ManifestPath);
+        return Result;
+    }
+
+    const FString JsonLinesPath = FPaths::Combine(Settings.OutputDirectory, JsonLinesFileName);
+    if (Settings.bWriteJsonLines)
+    {
+        JsonLinesWriter.Reset(IFileManager::Get().CreateFileWriter(*JsonLinesPath));
+        if (!JsonLinesWriter)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Bulk export could not open %s"), *JsonLinesPath);
+            ManifestWriter.Reset();
+            return Result;
+        }
+    }
+
+    bGatherFinished = false;
+    TFuture<void> Writer = Async(EAsyncExecution::Thread, [this]()
+    {
+        RunWriter();
+    });
+
+    for (int32 AssetIndex = 0; AssetIndex < Assets.Num(); ++AssetIndex)
+    {
+        TUniquePtr<FJob> Job = AcquireJob();
+        Job->AssetData = Assets[AssetIndex];
+        GatherAsset(*Job);
+
+        if (Job->bGathered)
+        {
+            FJob* EncodedJob = Job.Get();
+            const bool bJsonLines = Settings.bWriteJsonLines;
+            EncodedJob->EncodeTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [EncodedJob, bJsonLines]()
+            {
+                EncodeJob(*EncodedJob, bJsonLines);
+            });
+        }
+        EnqueueJob(MoveTemp(Job));
+
+        SampleMemory();
+        CollectGarbageIfOverBudget();
+
+        if ((AssetIndex + 1) % 100 == 0)
+        {
+            UE_LOG(LogTemp, Display, TEXT("Bulk export: %d/%d assets, %.0f MB peak, %d GC passes"),
+                AssetIndex + 1, Assets.Num(), PeakUsedPhysical / (1024.0 * 1024.0), Result.NumGarbageCollections);
+        }
+    }
+
+    {
+        FScopeLock Lock(&QueueLock);
+        bGatherFinished = true;
+    }
+    JobQueued->Trigger();
+    Writer.Wait();
+
+    ManifestWriter->Close();
+    ManifestWriter.Reset();
+
+    if (JsonLinesWriter)
+    {
+        JsonLinesWriter->Close();
+        JsonLinesWriter.Reset();
+        IndexWriter.Save(FGeoBlueprintJsonIndexReader::GetIndexPath(JsonLinesPath));
+    }
+    FreeJobs.Empty();
+
+    Result.PeakMemoryMB = static_cast<float>(PeakUsedPhysical / (1024.0 * 1024.0));
+    Result.ElapsedSeconds = static_cast<float>(FPlatformTime::Seconds() - StartTime);
+    WriteSummary();
+
+    UE_LOG(LogTemp, Log, TEXT("Bulk export finished: %d exported, %d failed, %.0f MB peak, %d GC passes in %.1fs"),
+        Result.NumExported, Result.NumFailed, Result.PeakMemoryMB, Result.NumGarbageCollections, Result.ElapsedSeconds);
+    return Result;
+}
+
+void FGeoBlueprintJsonBulkExporter::FJob::Reset()
+{
+    // The arena keeps its first page and the buffer its allocation, so a recycled job exports without touching the heap
+    AssetData = FAssetData();
+    bGathered = false;
+    Arena.Reset();
+    BlueprintObject = nullptr;
+    Records.Reset();
+    Bytes.Reset();
+    EncodeTask = UE::Tasks::FTask();
+}
+
+TUniquePtr<FGeoBlueprintJsonBulkExporter::FJob> FGeoBlueprintJsonBulkExporter::AcquireJob()
+{
+    {
+        FScopeLock Lock(&QueueLock);
+        if (FreeJobs.Num() > 0)
+        {
+            return FreeJobs.Pop(EAllowShrinking::No);
+        }
+    }
+    return MakeUnique<FJob>();
+}
+
+void FGeoBlueprintJsonBulkExporter::EnqueueJob(TUniquePtr<FJob> Job)
+{
+    const int32 PipelineDepth = FMath::Max(1, Settings.PipelineDepth);
+    for (;;)
+    {
+        {
+            FScopeLock Lock(&QueueLock);
+            if (PendingJobs.Num() < PipelineDepth)
+            {
+                PendingJobs.Add(MoveTemp(Job));
+                break;
+            }
+        }
+
+        // Backpressure: the writer frees a slot each time it takes the oldest job
+        SlotFreed->Wait();
+    }
+    JobQueued->Trigger();
+}
+
+void FGeoBlueprintJsonBulkExporter::GatherAsset(FJob& Job)
+{
+    // Only what this load pulls in is released later; packages resident before, or opened meanwhile, are left alone
+    UBlueprint* Blueprint = Cast<UBlueprint>(LoadedPackages.LoadAsset(Job.AssetData));
+    if (!Blueprint)
+    {
+        return;
+    }
+
+    if (Settings.bWriteJsonLines)
+    {
+        GatherAssetRecords(Job, Blueprint);
+        return;
+    }
+
+    FGeoBlueprintJsonGraphExporter Exporter(Job.Arena);
+    if (Settings.bShareInheritedData)
+    {
+        Exporter.SetInheritanceCache(&InheritanceCache);
+    }
+    Job.BlueprintObject = Exporter.BuildBlueprintObject(Blueprint);
+    Job.bGathered = Job.BlueprintObject != nullptr;
+}
+
+void FGeoBlueprintJsonBulkExporter::GatherAssetRecords(FJob& Job, UBlueprint* Blueprint)
+{
+    const FString AssetPath = Job.AssetData.GetObjectPathString();
+    FGeoBlueprintJsonGraphExporter Exporter(Job.Arena);
+    if (Settings.bShareInheritedData)
+    {
+        Exporter.SetInheritanceCache(&InheritanceCache);
+    }
+
+    // The Blueprint record carries the header fields and the graph names, keyed by an empty graph name
+    FGeoJsonObject* BlueprintObject = Exporter.BuildBlueprintHeaderObject(Blueprint);
+    if (!BlueprintObject)
+    {
+        return;
+    }
+    FGeoJsonArray* GraphNamesArray = BlueprintObject->SetArrayField(TEXT("Graphs"));
+    FGeoBlueprintJsonGraphExporter::ForEachExportedGraph(Blueprint, [GraphNamesArray](UEdGraph* Graph, const TCHAR* GraphType)
+    {
+        GraphNamesArray->AddString(FGeoBlueprintJsonGraphExporter::GetGraphPath(Graph));
+    });
+
+    FGeoJsonObject* BlueprintRecord = Job.Arena.New<FGeoJsonObject>(Job.Arena);
+    BlueprintRecord->SetStringField(TEXT("AssetPath"), AssetPath);
+    BlueprintRecord->SetObjectField(TEXT("Blueprint"), BlueprintObject);
+    Job.Records.Add({ FString(), BlueprintRecord });
+
+    FGeoBlueprintJsonGraphExporter::ForEachExportedGraph(Blueprint, [&Job, &Exporter, &AssetPath](UEdGraph* Graph, const TCHAR* GraphType)
+    {
+        if (FGeoJsonObject* GraphObject = Exporter.BuildGraphObject(Graph, GraphType))
+        {
+            FGeoJsonObject* GraphRecord = Job.Arena.New<FGeoJsonObject>(Job.Arena);
+            GraphRecord->SetStringField(TEXT("AssetPath"), AssetPath);
+            GraphRecord->SetObjectField(TEXT("Graph"), GraphObject);
+            Job.Records.Add({ FGeoBlueprintJsonGraphExporter::GetGraphPath(Graph), GraphRecord });
+        }
+    });
+    Exporter.AddBlueprintContentHash(*BlueprintObject, Blueprint);
+    Job.bGathered = true;
+}
+
+void FGeoBlueprintJsonBulkExporter::EncodeJob(FJob& Job, bool bJsonLines)
+{
+    if (!bJsonLines)
+    {
+        Job.BlueprintObject->SerializeUtf8(Job.Bytes);
+        return;
+    }
+
+    // Records are condensed so each one is exactly one line
+    for (FJob::FRecord& Record : Job.Records)
+    {
+        Record.Offset = Job.Bytes.Num();
+        Record.Object->SerializeUtf8(Job.Bytes, false);
+        Record.Length = Job.Bytes.Num() - Record.Offset;
+        Record.ContentHash = FGeoBlueprintJsonIndexWriter::HashBytes(Job.Bytes.GetData() + Record.Offset, Record.Length);
+        Job.Bytes.Add('\n');
+    }
+}
+
+void FGeoBlueprintJsonBulkExporter::RunWriter()
+{
+    for (;;)
+    {
+        TUniquePtr<FJob> Job;
+        bool bFinished = false;
+        {
+            FScopeLock Lock(&QueueLock);
+            if (PendingJobs.Num() > 0)
+            {
+                Job = MoveTemp(PendingJobs[0]);
+                PendingJobs.RemoveAt(0, 1, EAllowShrinking::No);
+            }
+            else
+            {
+                bFinished = bGatherFinished;
+            }
+        }
+
+        if (!Job)
+        {
+            if (bFinished)
+            {
+                return;
+            }
+            JobQueued->Wait();
+            continue;
+        }
+        SlotFreed->Trigger();
+
+        // Jobs are written in the order they were gathered, so the manifest and JSON Lines offsets are deterministic
+        if (Job->EncodeTask.IsValid())
+        {
+            Job->EncodeTask.Wait();
+        }
+
+        int64 BytesWritten = 0;
+        const bool bSucceeded = Job->bGathered && WriteJob(*Job, BytesWritten);
+        if (bSucceeded)
+        {
+            ++Result.NumExported;
+        }
+        else
+        {
+            ++Result.NumFailed;
+            UE_LOG(LogTemp, Warning, TEXT("Bulk export failed for %s"), *Job->AssetData.GetObjectPathString());
+        }
+        WriteManifestLine(Job->AssetData, bSucceeded, BytesWritten);
+
+        Job->Reset();
+        FScopeLock Lock(&QueueLock);
+        FreeJobs.Add(MoveTemp(Job));
+    }
+}
+
+bool FGeoBlueprintJsonBulkExporter::WriteJob(const FJob& Job, int64& OutBytesWritten)
+{
+    if (Settings.bWriteJsonLines)
+    {
+        const FString AssetPath = Job.AssetData.GetObjectPathString();
+        const int64 BaseOffset = JsonLinesWriter->Tell();
+        JsonLinesWriter->Serialize(const_cast<uint8*>(Job.Bytes.GetData()), Job.Bytes.Num());
+        for (const FJob::FRecord& Record : Job.Records)
+        {
+            IndexWriter.AddEntry(FGeoBlueprintJsonIndexWriter::MakeKey(AssetPath, Record.GraphName), Record.ContentHash, BaseOffset + Record.Offset, Record.Length);
+        }
+        OutBytesWritten = Job.Bytes.Num();
+        return !JsonLinesWriter->IsError();
+    }
+
+    TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*GetOutputFilePath(Job.AssetData)));
+    if (!FileWriter)
+    {
+        return false;
+    }
+
+    FileWriter->Serialize(const_cast<uint8*>(Job.Bytes.GetData()), Job.Bytes.Num());
+    OutBytesWritten = Job.Bytes.Num();
+    return FileWriter->Close();
+}
+
+FString FGeoBlueprintJsonBulkExporter::GetRelativeOutputPath(const FAssetData& AssetData)
+{
+    // /Game/Foo/BP_Bar becomes Game/Foo/BP_Bar.json
+    FString RelativePath = AssetData.PackageName.ToString();
+    RelativePath.RemoveFromStart(TEXT("/"));
+    return RelativePath + TEXT(".json");
+}
+
+FString FGeoBlueprintJsonBulkExporter::GetOutputFilePath(const FAssetData& AssetData) const
+{
+    return FPaths::Combine(Settings.OutputDirectory, GetRelativeOutputPath(AssetData));
+}
+
+void FGeoBlueprintJsonBulkExporter::WriteManifestLine(const FAssetData& AssetData, bool bSucceeded, int64 BytesWritten)
+{
+    FGeoJsonArena LineArena(1024);
+    FGeoJsonObject LineObject(LineArena);
+    LineObject.SetStringField(TEXT("AssetPath"), AssetData.GetObjectPathString());
+    LineObject.SetStringField(TEXT("File"), !bSucceeded ? FString() : Settings.bWriteJsonLines ? FString(JsonLinesFileName) : GetRelativeOutputPath(AssetData));
+    LineObject.SetNumberField(TEXT("Bytes"), static_cast<double>(BytesWritten));
+    LineObject.SetStringField(TEXT("Status"), bSucceeded ? TEXT("Exported") : TEXT("Failed"));
+
+    TArray<uint8> Line;
+    LineObject.SerializeUtf8(Line, false);
+    Line.Add('\n');
+    ManifestWriter->Serialize(Line.GetData(), Line.Num());
+}
+
+void FGeoBlueprintJsonBulkExporter::WriteSummary()
+{
+    TSharedRef<FJsonObject> SummaryObject = MakeShared<FJsonObject>();
+    SummaryObject->SetNumberField(TEXT("NumExported"), Result.NumExported);
+    SummaryObject->SetNumberField(TEXT("NumFailed"), Result.NumFailed);
+    SummaryObject->SetNumberField(TEXT("NumGarbageCollections"), Result.NumGarbageCollections);
+    SummaryObject->SetNumberField(TEXT("PeakMemoryMB"), Result.PeakMemoryMB);
+    SummaryObject->SetNumberField(TEXT("MemoryBudgetMB"), static_cast<double>(MemoryBudgetBytes / (1024 * 1024)));
+    SummaryObject->SetNumberField(TEXT("ElapsedSeconds"), Result.ElapsedSeconds);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(SummaryObject, Writer);
+    FFileHelper::SaveStringToFile(OutputString, *FPaths::Combine(Settings.OutputDirectory, TEXT("Summary.json")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+}
+
+void FGeoBlueprintJsonBulkExporter::SampleMemory()
+{
+    const FPlatformMemoryStats Stats = FPlatformMemory::GetStats();
+    PeakUsedPhysical = FMath::Max(PeakUsedPhysical, static_cast<uint64>(Stats.UsedPhysical));
+}
+
+void FGeoBlueprintJsonBulkExporter::CollectGarbageIfOverBudget()
+{
+    if (FPlatformMemory::GetStats().UsedPhysical < MemoryBudgetBytes)
+    {
+        return;
+    }
+
+    LoadedPackages.ReleasePackages();
+    {
+        // Pooled jobs hold on to the largest arena and buffer seen so far
+        FScopeLock Lock(&QueueLock);
+        FreeJobs.Empty();
+    }
+    CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+    ++Result.NumGarbageCollections;
+
+    const uint64 UsedAfterCollection = FPlatformMemory::GetStats().UsedPhysical;
+    if (UsedAfterCollection >= MemoryBudgetBytes)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Bulk export is still over its %llu MB budget after garbage collection (%llu MB resident)"),
+            MemoryBudgetBytes / (1024 * 1024), UsedAfterCollection / (1024 * 1024));
+    }
+}
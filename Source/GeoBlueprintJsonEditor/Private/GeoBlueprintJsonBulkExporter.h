@@ -0,0 +1,115 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "GeoBlueprintJsonBulkExport.h"
+#include "GeoBlueprintJsonDom.h"
+#include "GeoBlueprintJsonIndex.h"
+#include "GeoBlueprintJsonInheritanceCache.h"
+#include "GeoBlueprintJsonPackageTracker.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/Event.h"
+#include "Tasks/Task.h"
+
+class FArchive;
+class UBlueprint;
+
+/**
+ * Exports a list of Blueprint assets while keeping resident memory under a budget.
+ *
+ * Assets flow through three stages. The game thread loads each asset and gathers its graphs into
+ * an arena DOM, which holds no references to UObjects. Worker tasks encode the DOM to UTF-8 and
+ * hash the records. A dedicated writer thread writes the files and the manifest in asset order.
+ * At most Settings.PipelineDepth assets wait between gathering and writing, so a slow stage holds
+ * the others back instead of piling up memory, and throughput follows the slowest stage.
+ *
+ * Whenever the budget is exceeded, the packages the export loaded itself are released and garbage is
+ * collected. That only touches the game thread stage, since later stages work on DOM copies.
+ *
+ * With Settings.bShareInheritedData assets are exported parent-first, and each child is gathered
+ * against the inheritance cache its parent left behind.
+ */
+class FGeoBlueprintJsonBulkExporter
+{
+public:
+    explicit FGeoBlueprintJsonBulkExporter(const FGeoBlueprintJsonBulkExportSettings& InSettings);
+    ~FGeoBlueprintJsonBulkExporter();
+
+    /** Finds the Blueprint assets matching the settings, sorted by package name */
+    static TArray<FAssetData> GatherBlueprintAssets(const FGeoBlueprintJsonBulkExportSettings& Settings);
+
+    /** Finds the Blueprint assets in the given packages, sorted by package name */
+    static TArray<FAssetData> GatherBlueprintAssets(const TArray<FName>& PackageNames);
+
+    FGeoBlueprintJsonBulkExportResult Run(const TArray<FAssetData>& Assets);
+
+    /** Path of an asset's export file relative to the output directory, as recorded in the manifest */
+    static FString GetRelativeOutputPath(const FAssetData& AssetData);
+
+    /** File name of the JSON Lines export; its index is FGeoBlueprintJsonIndexReader::GetIndexPath of it */
+    static constexpr const TCHAR* JsonLinesFileName = TEXT("Export.jsonl");
+
+private:
+    /** One asset on its way through the pipeline. Jobs are recycled so their arena and buffer are reused. */
+    struct FJob
+    {
+        struct FRecord
+        {
+            FString GraphName;
+            FGeoJsonObject* Object = nullptr;
+            int32 Offset = 0;
+            int32 Length = 0;
+            uint64 ContentHash = 0;
+        };
+
+        FAssetData AssetData;
+        bool bGathered = false;
+        FGeoJsonArena Arena;
+
+        /** The whole Blueprint for per-asset files, or one record per line for JSON Lines */
+        FGeoJsonObject* BlueprintObject = nullptr;
+        TArray<FRecord> Records;
+
+        TArray<uint8> Bytes;
+        UE::Tasks::FTask EncodeTask;
+
+        void Reset();
+    };
+
+    // Game thread stage
+    TUniquePtr<FJob> AcquireJob();
+    void GatherAsset(FJob& Job);
+    void GatherAssetRecords(FJob& Job, UBlueprint* Blueprint);
+    void EnqueueJob(TUniquePtr<FJob> Job);
+
+    // Worker stage
+    static void EncodeJob(FJob& Job, bool bJsonLines);
+
+    // Writer stage
+    void RunWriter();
+    bool WriteJob(const FJob& Job, int64& OutBytesWritten);
+    void WriteManifestLine(const FAssetData& AssetData, bool bSucceeded, int64 BytesWritten);
+    void WriteSummary();
+    FString GetOutputFilePath(const FAssetData& AssetData) const;
+
+    void SampleMemory();
+    void CollectGarbageIfOverBudget();
+
+    FGeoBlueprintJsonBulkExportSettings Settings;
+    FGeoBlueprintJsonBulkExportResult Result;
+    TUniquePtr<FArchive> ManifestWriter;
+    TUniquePtr<FArchive> JsonLinesWriter;
+    FGeoBlueprintJsonIndexWriter IndexWriter;
+    FGeoBlueprintJsonPackageTracker LoadedPackages;
+    FGeoBlueprintJsonInheritanceCache InheritanceCache;
+    uint64 MemoryBudgetBytes = 0;
+    uint64 PeakUsedPhysical = 0;
+
+    // Queue between the gathering and writing stages, in asset order
+    FCriticalSection QueueLock;
+    TArray<TUniquePtr<FJob>> PendingJobs;
+    TArray<TUniquePtr<FJob>> FreeJobs;
+    bool bGatherFinished = false;
+    FEventRef JobQueued;
+    FEventRef SlotFreed;
+};
@@ -0,0 +1,110 @@
+#include "GeoBlueprintJsonCompileProfiler.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "Kismet2/CompilerResultsLog.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "UObject/Class.h"
+#include "UObject/UnrealType.h"
+
+namespace GeoBlueprintJsonCompileProfiler
+{
+    static constexpr EBlueprintCompileOptions CompileOptions = EBlueprintCompileOptions::SkipGarbageCollection | EBlueprintCompileOptions::SkipSave;
+
+    static double Median(TArray<double>& Samples)
+    {
+        Samples.Sort();
+        const int32 Middle = Samples.Num() / 2;
+        return Samples.Num() % 2 == 1 ? Samples[Middle] : (Samples[Middle - 1] + Samples[Middle]) * 0.5;
+    }
+
+    static double Min(const TArray<double>& Samples)
+    {
+        return FMath::Min(Samples);
+    }
+
+    static double TimeMs(TFunctionRef<void()> Function)
+    {
+        const double StartTime = FPlatformTime::Seconds();
+        Function();
+        return (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    }
+}
+
+FGeoBlueprintJsonCompileProfile FGeoBlueprintJsonCompileProfiler::ProfileBlueprint(UBlueprint* Blueprint, int32 Iterations)
+{
+    using namespace GeoBlueprintJsonCompileProfiler;
+
+    FGeoBlueprintJsonCompileProfile Profile;
+    if (!Blueprint || !Blueprint->GeneratedClass)
+    {
+        return Profile;
+    }
+    Profile.Iterations = FMath::Max(1, Iterations);
+
+    // The warm-up compile is also the one whose results and recompiled dependents are reported
+    TSet<FString> Dependents;
+    FDelegateHandle PreCompileHandle;
+    if (GEditor)
+    {
+        PreCompileHandle = GEditor->OnBlueprintPreCompile().AddLambda([Blueprint, &Dependents](UBlueprint* CompiledBlueprint)
+        {
+            if (CompiledBlueprint && CompiledBlueprint != Blueprint)
+            {
+                Dependents.Add(CompiledBlueprint->GetPathName());
+            }
+        });
+    }
+
+    FCompilerResultsLog Results;
+    Results.bSilentMode = true;
+    FKismetEditorUtilities::CompileBlueprint(Blueprint, CompileOptions, &Results);
+
+    if (GEditor)
+    {
+        GEditor->OnBlueprintPreCompile().Remove(PreCompileHandle);
+    }
+    Profile.NumErrors = Results.NumErrors;
+    Profile.NumWarnings = Results.NumWarnings;
+    Profile.RecompiledDependents = Dependents.Array();
+    Profile.RecompiledDependents.Sort();
+
+    TArray<double> SkeletonSamples;
+    TArray<double> BytecodeSamples;
+    TArray<double> FullSamples;
+    for (int32 Iteration = 0; Iteration < Profile.Iterations; ++Iteration)
+    {
+        SkeletonSamples.Add(TimeMs([Blueprint]()
+        {
+            FKismetEditorUtilities::GenerateBlueprintSkeleton(Blueprint, true);
+        }));
+        BytecodeSamples.Add(TimeMs([Blueprint]()
+        {
+            FKismetEditorUtilities::RecompileBlueprintBytecode(Blueprint);
+        }));
+        FullSamples.Add(TimeMs([Blueprint]()
+        {
+            FCompilerResultsLog IterationResults;
+            IterationResults.bSilentMode = true;
+            FKismetEditorUtilities::CompileBlueprint(Blueprint, CompileOptions, &IterationResults);
+        }));
+    }
+
+    Profile.Min.SkeletonRegenerationMs = Min(SkeletonSamples);
+    Profile.Min.BytecodeRecompileMs = Min(BytecodeSamples);
+    Profile.Min.FullCompileMs = Min(FullSamples);
+    Profile.Median.SkeletonRegenerationMs = Median(SkeletonSamples);
+    Profile.Median.BytecodeRecompileMs = Median(BytecodeSamples);
+    Profile.Median.FullCompileMs = Median(FullSamples);
+
+    if (const UClass* GeneratedClass = Blueprint->GeneratedClass)
+    {
+        for (TFieldIterator<UFunction> It(GeneratedClass, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+        {
+            ++Profile.NumFunctions;
+            Profile.BytecodeBytes += It->Script.Num();
+        }
+    }
+
+    Profile.bCompiled = Blueprint->Status != BS_Error;
+    return Profile;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UBlueprint;
+
+/**
+ * Wall time of each compiler entry point, in milliseconds. Each is timed as a separate call, so the
+ * full compile repeats the work of the other two rather than being their sum.
+ */
+struct FGeoBlueprintJsonCompileTimes
+{
+    /**
+     * FKismetEditorUtilities::GenerateBlueprintSkeleton: the skeleton class from variables and
+     * function signatures
+     */
+    double SkeletonRegenerationMs = 0.0;
+
+    /**
+     * FKismetEditorUtilities::RecompileBlueprintBytecode: the function graphs against the existing
+     * class layout
+     */
+    double BytecodeRecompileMs = 0.0;
+
+    /**
+     * FKismetEditorUtilities::CompileBlueprint: skeleton, class layout, bytecode, reinstancing and
+     * dependent Blueprints
+     */
+    double FullCompileMs = 0.0;
+};
+
+struct FGeoBlueprintJsonCompileProfile
+{
+    bool bCompiled = false;
+    int32 Iterations = 0;
+
+    /** Per entry point, over the measured iterations */
+    FGeoBlueprintJsonCompileTimes Median;
+    FGeoBlueprintJsonCompileTimes Min;
+
+    /** Functions on the generated class, not counting inherited ones */
+    int32 NumFunctions = 0;
+    int64 BytecodeBytes = 0;
+
+    /** Other Blueprints a full compile of this one recompiled */
+    TArray<FString> RecompiledDependents;
+
+    int32 NumErrors = 0;
+    int32 NumWarnings = 0;
+};
+
+/**
+ * Compiles one Blueprint repeatedly and times the compiler's public entry points. The compilation
+ * manager runs its internal phases back to back, so they can't be timed on their own. One
+ * unmeasured full compile comes first, so the measured iterations don't pay for first-compile work
+ * after loading, and medians keep single slow runs from moving the result.
+ */
+class FGeoBlueprintJsonCompileProfiler
+{
+public:
+    static constexpr int32 DefaultIterations = 3;
+
+    static FGeoBlueprintJsonCompileProfile ProfileBlueprint(UBlueprint* Blueprint, int32 Iterations = DefaultIterations);
+};
@@ -0,0 +1,266 @@
+#include "GeoBlueprintJsonComponentAnalysis.h"
+#include "Components/ActorComponent.h"
+#include "Components/LightComponentBase.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/SceneComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/InheritableComponentHandler.h"
+#include "Engine/SCS_Node.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "GameFramework/Actor.h"
+
+namespace GeoBlueprintJsonComponentAnalysis
+{
+    static constexpr double TickCost = 10.0;
+    static constexpr double SimulatePhysicsCost = 8.0;
+    static constexpr double ShadowCastingLightCost = 6.0;
+    static constexpr double SkeletalMeshCost = 5.0;
+    static constexpr double OverlapEventsCost = 4.0;
+    static constexpr double ShadowCastingPrimitiveCost = 2.0;
+    static constexpr double QueryCollisionCost = 1.0;
+    static constexpr double PhysicsCollisionCost = 1.0;
+    static constexpr double HitEventsCost = 1.0;
+
+    static void AddComponent(FGeoBlueprintJsonActorCost& ActorCost, const FGeoBlueprintJsonComponentCost& Cost)
+    {
+        ActorCost.NumTicking += Cost.bTickEnabled ? 1 : 0;
+        ActorCost.NumOverlapping += Cost.bGenerateOverlapEvents && CollisionEnabledHasQuery(Cost.CollisionEnabled) ? 1 : 0;
+        ActorCost.NumSimulatingPhysics += Cost.bSimulatePhysics ? 1 : 0;
+        ActorCost.NumShadowCasters += Cost.bCastShadow ? 1 : 0;
+        ActorCost.EstimatedCost += Cost.EstimatedCost;
+        ActorCost.Components.Add(Cost);
+    }
+
+    static bool HasSameCost(const FGeoBlueprintJsonComponentCost& A, const FGeoBlueprintJsonComponentCost& B)
+    {
+        return A.ParentName == B.ParentName
+            && A.AttachSocketName == B.AttachSocketName
+            && A.bTickEnabled == B.bTickEnabled
+            && A.TickInterval == B.TickInterval
+            && A.bGenerateOverlapEvents == B.bGenerateOverlapEvents
+            && A.CollisionEnabled == B.CollisionEnabled
+            && A.CollisionProfileName == B.CollisionProfileName
+            && A.bSimulatePhysics == B.bSimulatePhysics
+            && A.bHitEvents == B.bHitEvents
+            && A.bCastShadow == B.bCastShadow;
+    }
+
+    static FGeoBlueprintJsonComponentCost AnalyzeNativeComponent(const UActorComponent* Component)
+    {
+        FGeoBlueprintJsonComponentCost Cost = FGeoBlueprintJsonComponentAnalysis::AnalyzeComponent(Component);
+        Cost.Source = TEXT("Native");
+        if (const USceneComponent* SceneComponent = Cast<USceneComponent>(Component))
+        {
+            if (const USceneComponent* AttachParent = SceneComponent->GetAttachParent())
+            {
+                Cost.ParentName = AttachParent->GetFName();
+                Cost.AttachSocketName = SceneComponent->GetAttachSocketName();
+            }
+        }
+        return Cost;
+    }
+
+    static const AActor* AnalyzeActorTick(FGeoBlueprintJsonActorCost& ActorCost, const UBlueprintGeneratedClass* GeneratedClass)
+    {
+        const AActor* ActorDefaults = GeneratedClass ? Cast<AActor>(GeneratedClass->GetDefaultObject(false)) : nullptr;
+        if (!ActorDefaults)
+        {
+            return nullptr;
+        }
+
+        ActorCost.bIsActor = true;
+        ActorCost.bActorTickEnabled = ActorDefaults->PrimaryActorTick.bCanEverTick && ActorDefaults->PrimaryActorTick.bStartWithTickEnabled;
+        ActorCost.ActorTickInterval = ActorDefaults->PrimaryActorTick.TickInterval;
+        if (ActorCost.bActorTickEnabled)
+        {
+            ActorCost.EstimatedCost += FGeoBlueprintJsonComponentAnalysis::GetTickCost(ActorCost.ActorTickInterval);
+        }
+        return ActorDefaults;
+    }
+
+    static void AddScsNode(FGeoBlueprintJsonActorCost& ActorCost, const USCS_Node* Node, FName ParentName, UBlueprintGeneratedClass* ActualClass, const TCHAR* Source)
+    {
+        if (!Node)
+        {
+            return;
+        }
+
+        // A child Blueprint can override an inherited template; the actual template has those overrides
+        if (const UActorComponent* Template = Node->GetActualComponentTemplate(ActualClass))
+        {
+            FGeoBlueprintJsonComponentCost Cost = FGeoBlueprintJsonComponentAnalysis::AnalyzeComponent(Template);
+            Cost.Name = Node->GetVariableName();
+            Cost.ParentName = ParentName;
+            Cost.AttachSocketName = Node->AttachToName;
+            Cost.Source = Source;
+            AddComponent(ActorCost, Cost);
+        }
+
+        for (const USCS_Node* ChildNode : Node->GetChildNodes())
+        {
+            AddScsNode(ActorCost, ChildNode, Node->GetVariableName(), ActualClass, Source);
+        }
+    }
+}
+
+double FGeoBlueprintJsonComponentAnalysis::GetTickCost(float TickInterval)
+{
+    constexpr double FrameTime = 1.0 / 60.0;
+    return GeoBlueprintJsonComponentAnalysis::TickCost * (TickInterval > FrameTime ? FrameTime / TickInterval : 1.0);
+}
+
+FGeoBlueprintJsonComponentCost FGeoBlueprintJsonComponentAnalysis::AnalyzeComponent(const UActorComponent* Template)
+{
+    using namespace GeoBlueprintJsonComponentAnalysis;
+
+    FGeoBlueprintJsonComponentCost Cost;
+    if (!Template)
+    {
+        return Cost;
+    }
+
+    Cost.Template = Template;
+    Cost.Name = Template->GetFName();
+    Cost.bTickEnabled = Template->PrimaryComponentTick.bCanEverTick && Template->PrimaryComponentTick.bStartWithTickEnabled;
+    Cost.TickInterval = Template->PrimaryComponentTick.TickInterval;
+    if (Cost.bTickEnabled)
+    {
+        Cost.EstimatedCost += GetTickCost(Cost.TickInterval);
+    }
+
+    if (const UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Template))
+    {
+        Cost.CollisionEnabled = Primitive->GetCollisionEnabled();
+        Cost.CollisionProfileName = Primitive->GetCollisionProfileName();
+        Cost.bGenerateOverlapEvents = Primitive->GetGenerateOverlapEvents();
+        Cost.bSimulatePhysics = Primitive->BodyInstance.bSimulatePhysics;
+        Cost.bHitEvents = Primitive->BodyInstance.bNotifyRigidBodyCollision;
+        Cost.bCastShadow = Primitive->CastShadow && Primitive->GetVisibleFlag();
+
+        // Overlap events only cost anything when the component can be found by overlap queries
+        const bool bQueryCollision = CollisionEnabledHasQuery(Cost.CollisionEnabled);
+        Cost.EstimatedCost += bQueryCollision ? QueryCollisionCost : 0.0;
+        Cost.EstimatedCost += CollisionEnabledHasPhysics(Cost.CollisionEnabled) ? PhysicsCollisionCost : 0.0;
+        Cost.EstimatedCost += Cost.bGenerateOverlapEvents && bQueryCollision ? OverlapEventsCost : 0.0;
+        Cost.EstimatedCost += Cost.bSimulatePhysics ? SimulatePhysicsCost : 0.0;
+        Cost.EstimatedCost += Cost.bHitEvents ? HitEventsCost : 0.0;
+        Cost.EstimatedCost += Cost.bCastShadow ? ShadowCastingPrimitiveCost : 0.0;
+        Cost.EstimatedCost += Primitive->IsA<USkeletalMeshComponent>() ? SkeletalMeshCost : 0.0;
+    }
+    else if (const ULightComponentBase* Light = Cast<ULightComponentBase>(Template))
+    {
+        Cost.bCastShadow = Light->CastShadows && Light->GetVisibleFlag();
+        Cost.EstimatedCost += Cost.bCastShadow ? ShadowCastingLightCost : 0.0;
+    }
+
+    return Cost;
+}
+
+FGeoBlueprintJsonActorCost FGeoBlueprintJsonComponentAnalysis::AnalyzeBlueprint(const UBlueprint* Blueprint)
+{
+    using namespace GeoBlueprintJsonComponentAnalysis;
+
+    FGeoBlueprintJsonActorCost ActorCost;
+    UBlueprintGeneratedClass* GeneratedClass = Blueprint ? Cast<UBlueprintGeneratedClass>(Blueprint->GeneratedClass) : nullptr;
+    const AActor* ActorDefaults = AnalyzeActorTick(ActorCost, GeneratedClass);
+    if (!ActorDefaults)
+    {
+        return ActorCost;
+    }
+
+    // Native default subobjects are the only components the class default object owns
+    for (const UActorComponent* Component : ActorDefaults->GetComponents())
+    {
+        if (Component)
+        {
+            AddComponent(ActorCost, AnalyzeNativeComponent(Component));
+        }
+    }
+
+    // The hierarchy comes back child first
+    TArray<const UBlueprintGeneratedClass*> Hierarchy;
+    UBlueprintGeneratedClass::GetGeneratedClassesHierarchy(GeneratedClass, Hierarchy);
+    for (int32 Index = Hierarchy.Num() - 1; Index >= 0; --Index)
+    {
+        const USimpleConstructionScript* ConstructionScript = Hierarchy[Index]->SimpleConstructionScript;
+        if (!ConstructionScript)
+        {
+            continue;
+        }
+
+        const TCHAR* Source = Hierarchy[Index] == GeneratedClass ? TEXT("Blueprint") : TEXT("Inherited");
+        for (const USCS_Node* RootNode : ConstructionScript->GetRootNodes())
+        {
+            AddScsNode(ActorCost, RootNode, RootNode ? RootNode->ParentComponentOrVariableName : NAME_None, GeneratedClass, Source);
+        }
+    }
+
+    return ActorCost;
+}
+
+FGeoBlueprintJsonActorCost FGeoBlueprintJsonComponentAnalysis::AnalyzeBlueprintOverrides(const UBlueprint* Blueprint)
+{
+    using namespace GeoBlueprintJsonComponentAnalysis;
+
+    FGeoBlueprintJsonActorCost ActorCost;
+    UBlueprintGeneratedClass* GeneratedClass = Blueprint ? Cast<UBlueprintGeneratedClass>(Blueprint->GeneratedClass) : nullptr;
+    const AActor* ActorDefaults = AnalyzeActorTick(ActorCost, GeneratedClass);
+    if (!ActorDefaults)
+    {
+        return ActorCost;
+    }
+
+    // Native components can only change through the class default object, so compare with the parent's
+    const AActor* ParentDefaults = Cast<AActor>(GeneratedClass->GetSuperClass()->GetDefaultObject(false));
+    for (const UActorComponent* Component : ActorDefaults->GetComponents())
+    {
+        if (!Component)
+        {
+            continue;
+        }
+
+        const FGeoBlueprintJsonComponentCost Cost = AnalyzeNativeComponent(Component);
+        const UActorComponent* ParentTemplate = ParentDefaults ? Cast<UActorComponent>(ParentDefaults->GetDefaultSubobjectByName(Component->GetFName())) : nullptr;
+        if (!ParentTemplate || !HasSameCost(Cost, AnalyzeNativeComponent(ParentTemplate)))
+        {
+            AddComponent(ActorCost, Cost);
+        }
+    }
+
+    // Overridden inherited templates, named and attached like the node they override
+    if (const UInheritableComponentHandler* ComponentHandler = GeneratedClass->GetInheritableComponentHandler())
+    {
+        TArray<UActorComponent*> OverrideTemplates;
+        ComponentHandler->GetAllTemplates(OverrideTemplates);
+        for (UActorComponent* Template : OverrideTemplates)
+        {
+            USCS_Node* Node = ComponentHandler->FindKey(Template).FindSCSNode();
+            if (!Node)
+            {
+                continue;
+            }
+
+            const USimpleConstructionScript* ConstructionScript = Node->GetSCS();
+            const USCS_Node* ParentNode = ConstructionScript ? ConstructionScript->FindParentNode(Node) : nullptr;
+
+            FGeoBlueprintJsonComponentCost Cost = AnalyzeComponent(Template);
+            Cost.Name = Node->GetVariableName();
+            Cost.ParentName = ParentNode ? ParentNode->GetVariableName() : Node->ParentComponentOrVariableName;
+            Cost.AttachSocketName = Node->AttachToName;
+            Cost.Source = TEXT("Inherited");
+            AddComponent(ActorCost, Cost);
+        }
+    }
+
+    if (const USimpleConstructionScript* ConstructionScript = GeneratedClass->SimpleConstructionScript)
+    {
+        for (const USCS_Node* RootNode : ConstructionScript->GetRootNodes())
+        {
+            AddScsNode(ActorCost, RootNode, RootNode ? RootNode->ParentComponentOrVariableName : NAME_None, GeneratedClass, TEXT("Blueprint"));
+        }
+    }
+
+    return ActorCost;
+}
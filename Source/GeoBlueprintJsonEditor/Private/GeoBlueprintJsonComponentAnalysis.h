@@ -0,0 +1,80 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+
+class UActorComponent;
+class UBlueprint;
+
+/** Cost-relevant defaults of one component template */
+struct FGeoBlueprintJsonComponentCost
+{
+    const UActorComponent* Template = nullptr;
+    FName Name;
+
+    /** The component this one attaches to, or None for the root */
+    FName ParentName;
+    FName AttachSocketName;
+
+    /** Native for default subobjects of a C++ class, Inherited for a parent Blueprint's construction script */
+    const TCHAR* Source = TEXT("Blueprint");
+
+    bool bTickEnabled = false;
+    float TickInterval = 0.0f;
+    bool bGenerateOverlapEvents = false;
+    TEnumAsByte<ECollisionEnabled::Type> CollisionEnabled = ECollisionEnabled::NoCollision;
+    FName CollisionProfileName;
+    bool bSimulatePhysics = false;
+    bool bHitEvents = false;
+    bool bCastShadow = false;
+
+    /** Relative per-instance cost, see FGeoBlueprintJsonComponentAnalysis */
+    double EstimatedCost = 0.0;
+};
+
+/** Components a spawned instance of a Blueprint gets, with the actor's own tick */
+struct FGeoBlueprintJsonActorCost
+{
+    /** False for Blueprints that don't generate an actor class; everything else is then left empty */
+    bool bIsActor = false;
+
+    bool bActorTickEnabled = false;
+    float ActorTickInterval = 0.0f;
+    TArray<FGeoBlueprintJsonComponentCost> Components;
+
+    int32 NumTicking = 0;
+    int32 NumOverlapping = 0;
+    int32 NumSimulatingPhysics = 0;
+    int32 NumShadowCasters = 0;
+
+    /** The actor tick plus every component */
+    double EstimatedCost = 0.0;
+};
+
+/**
+ * Reads the component templates of an actor Blueprint: native default subobjects first, then the
+ * Simple Construction Script of each Blueprint in the class chain, parent-first, with this Blueprint's
+ * overrides of inherited templates applied.
+ *
+ * The estimated cost is a relative score for ranking, not a time. A component ticking every frame
+ * scores 10, scaled down by a tick interval; a simulated body 8; a shadow-casting light 6; a skeletal
+ * mesh 5; overlap events with query collision 4; a shadow-casting primitive 2; collision 1 for queries
+ * plus 1 for physics; hit events 1.
+ */
+class FGeoBlueprintJsonComponentAnalysis
+{
+public:
+    static FGeoBlueprintJsonActorCost AnalyzeBlueprint(const UBlueprint* Blueprint);
+
+    /**
+     * Only what a Blueprint adds to its parent Blueprint: native components whose cost-relevant
+     * defaults differ from the parent's, inherited templates it overrides, and its own construction
+     * script. No parent construction script is walked. The actor tick is filled in as usual.
+     */
+    static FGeoBlueprintJsonActorCost AnalyzeBlueprintOverrides(const UBlueprint* Blueprint);
+
+    static FGeoBlueprintJsonComponentCost AnalyzeComponent(const UActorComponent* Template);
+
+    /** Per-frame tick cost, scaled by how much of a 60 Hz frame rate the interval leaves */
+    static double GetTickCost(float TickInterval);
+};
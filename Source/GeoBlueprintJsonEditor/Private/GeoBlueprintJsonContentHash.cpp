@@ -0,0 +1,272 @@
+#include "GeoBlueprintJsonContentHash.h"
+#include "GeoBlueprintJsonGraphExporter.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "EdGraph/EdGraphSchema.h"
+#include "Engine/Blueprint.h"
+#include "Hash/xxhash.h"
+
+namespace GeoBlueprintJsonContentHash
+{
+    // Strings are hashed as length-prefixed UTF-8 so hashes match across platforms with different TCHAR widths
+    void UpdateString(FXxHash64Builder& Builder, FStringView Value)
+    {
+        FTCHARToUTF8 Utf8Value(Value.GetData(), Value.Len());
+        const int32 Length = Utf8Value.Length();
+        Builder.Update(&Length, sizeof(Length));
+        Builder.Update(Utf8Value.Get(), Length);
+    }
+
+    void UpdateName(FXxHash64Builder& Builder, FName Value)
+    {
+        UpdateString(Builder, Value.ToString());
+    }
+
+    void UpdateObjectPath(FXxHash64Builder& Builder, const UObject* Object)
+    {
+        UpdateString(Builder, Object ? Object->GetPathName() : FString());
+    }
+
+    template <typename T>
+    void UpdateValue(FXxHash64Builder& Builder, T Value)
+    {
+        static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>, "Only plain values are hashed by their bytes");
+        Builder.Update(&Value, sizeof(Value));
+    }
+
+    uint64 HashSorted(FXxHash64Builder& Builder, TArray<uint64>& Hashes)
+    {
+        Hashes.Sort();
+        UpdateValue(Builder, Hashes.Num());
+        Builder.Update(Hashes.GetData(), Hashes.Num() * sizeof(uint64));
+        return Builder.Finalize().Hash;
+    }
+
+    // Properties describing where a node sits on the canvas
+    const FName LayoutProperties[] =
+    {
+        TEXT("NodePosX"),
+        TEXT("NodePosY"),
+        TEXT("NodeWidth"),
+        TEXT("NodeHeight"),
+        TEXT("bCommentBubblePinned"),
+        TEXT("bCommentBubbleVisible"),
+        TEXT("bCommentBubbleMakeVisible"),
+    };
+
+    // Identity and compiler state that changes without the graph changing
+    const FName IgnoredProperties[] =
+    {
+        TEXT("NodeGuid"),
+        TEXT("bHasCompilerMessage"),
+        TEXT("ErrorType"),
+        TEXT("ErrorMsg"),
+        TEXT("NodeUpgradeMessage"),
+        TEXT("DeprecatedPins"),
+    };
+}
+
+FGeoBlueprintJsonContentHasher::FGeoBlueprintJsonContentHasher(bool bInIncludeLayout)
+    : bIncludeLayout(bInIncludeLayout)
+{
+}
+
+FString FGeoBlueprintJsonContentHasher::ToString(uint64 Hash)
+{
+    return FString::Printf(TEXT("%016llx"), Hash);
+}
+
+bool FGeoBlueprintJsonContentHasher::IsHashedProperty(const FProperty* Property) const
+{
+    using namespace GeoBlueprintJsonContentHash;
+
+    if (Property->HasAnyPropertyFlags(CPF_Transient | CPF_DuplicateTransient | CPF_NonPIEDuplicateTransient | CPF_Deprecated))
+    {
+        return false;
+    }
+
+    const FName PropertyName = Property->GetFName();
+    for (const FName IgnoredProperty : IgnoredProperties)
+    {
+        if (PropertyName == IgnoredProperty)
+        {
+            return false;
+        }
+    }
+
+    if (!bIncludeLayout)
+    {
+        for (const FName LayoutProperty : LayoutProperties)
+        {
+            if (PropertyName == LayoutProperty)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+uint64 FGeoBlueprintJsonContentHasher::HashNode(const UEdGraphNode* Node)
+{
+    using namespace GeoBlueprintJsonContentHash;
+
+    if (!Node)
+    {
+        return 0;
+    }
+    if (const uint64* CachedHash = NodeHashes.Find(Node))
+    {
+        return *CachedHash;
+    }
+
+    FXxHash64Builder Builder;
+    UpdateObjectPath(Builder, Node->GetClass());
+
+    // Properties go in by name and exported text, which is stable across saves and platforms
+    FString ValueText;
+    for (TFieldIterator<FProperty> It(Node->GetClass()); It; ++It)
+    {
+        const FProperty* Property = *It;
+        if (!IsHashedProperty(Property))
+        {
+            continue;
+        }
+
+        UpdateName(Builder, Property->GetFName());
+        for (int32 ArrayIndex = 0; ArrayIndex < Property->ArrayDim; ++ArrayIndex)
+        {
+            ValueText.Reset();
+            Property->ExportText_InContainer(ArrayIndex, ValueText, Node, nullptr, const_cast<UEdGraphNode*>(Node), PPF_None);
+            UpdateString(Builder, ValueText);
+        }
+    }
+
+    // Pin order is part of the node's signature, so pins are hashed in place
+    UpdateValue(Builder, Node->Pins.Num());
+    for (const UEdGraphPin* Pin : Node->Pins)
+    {
+        HashPin(Builder, Pin);
+    }
+
+    const uint64 Hash = Builder.Finalize().Hash;
+    NodeHashes.Add(Node, Hash);
+    return Hash;
+}
+
+void FGeoBlueprintJsonContentHasher::HashPin(FXxHash64Builder& Builder, const UEdGraphPin* Pin) const
+{
+    using namespace GeoBlueprintJsonContentHash;
+
+    if (!Pin)
+    {
+        UpdateValue(Builder, uint8(0));
+        return;
+    }
+
+    UpdateName(Builder, Pin->PinName);
+    UpdateName(Builder, Pin->ParentPin ? Pin->ParentPin->PinName : NAME_None);
+    UpdateValue(Builder, static_cast<uint8>(Pin->Direction));
+    UpdateValue(Builder, static_cast<bool>(Pin->bOrphanedPin));
+
+    const FEdGraphPinType& PinType = Pin->PinType;
+    UpdateName(Builder, PinType.PinCategory);
+    UpdateName(Builder, PinType.PinSubCategory);
+    UpdateObjectPath(Builder, PinType.PinSubCategoryObject.Get());
+    UpdateValue(Builder, static_cast<uint8>(PinType.ContainerType));
+    UpdateValue(Builder, static_cast<bool>(PinType.bIsReference));
+    UpdateValue(Builder, static_cast<bool>(PinType.bIsConst));
+    UpdateValue(Builder, static_cast<bool>(PinType.bIsWeakPointer));
+    UpdateValue(Builder, static_cast<bool>(PinType.bIsUObjectWrapper));
+    if (PinType.IsMap())
+    {
+        UpdateName(Builder, PinType.PinValueType.TerminalCategory);
+        UpdateName(Builder, PinType.PinValueType.TerminalSubCategory);
+        UpdateObjectPath(Builder, PinType.PinValueType.TerminalSubCategoryObject.Get());
+        UpdateValue(Builder, static_cast<bool>(PinType.PinValueType.bTerminalIsConst));
+        UpdateValue(Builder, static_cast<bool>(PinType.PinValueType.bTerminalIsWeakPointer));
+        UpdateValue(Builder, static_cast<bool>(PinType.PinValueType.bTerminalIsUObjectWrapper));
+    }
+
+    UpdateString(Builder, Pin->DefaultValue);
+    UpdateObjectPath(Builder, Pin->DefaultObject);
+    UpdateString(Builder, Pin->DefaultTextValue.BuildSourceString());
+}
+
+uint64 FGeoBlueprintJsonContentHasher::HashGraph(const UEdGraph* Graph)
+{
+    using namespace GeoBlueprintJsonContentHash;
+
+    if (!Graph)
+    {
+        return 0;
+    }
+    if (const uint64* CachedHash = GraphHashes.Find(Graph))
+    {
+        return *CachedHash;
+    }
+
+    TArray<uint64> ContentHashes;
+    ContentHashes.Reserve(Graph->Nodes.Num() * 2);
+
+    for (const UEdGraphNode* Node : Graph->Nodes)
+    {
+        if (!Node)
+        {
+            continue;
+        }
+        const uint64 NodeHash = HashNode(Node);
+        ContentHashes.Add(NodeHash);
+
+        // Each link is hashed once, from its output end, by the hashes and pin names of both ends
+        for (const UEdGraphPin* Pin : Node->Pins)
+        {
+            if (!Pin || Pin->Direction != EGPD_Output)
+            {
+                continue;
+            }
+            for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+            {
+                if (!LinkedPin || !LinkedPin->GetOwningNodeUnchecked())
+                {
+                    continue;
+                }
+
+                FXxHash64Builder EdgeBuilder;
+                UpdateValue(EdgeBuilder, NodeHash);
+                UpdateName(EdgeBuilder, Pin->PinName);
+                UpdateValue(EdgeBuilder, HashNode(LinkedPin->GetOwningNodeUnchecked()));
+                UpdateName(EdgeBuilder, LinkedPin->PinName);
+                ContentHashes.Add(EdgeBuilder.Finalize().Hash);
+            }
+        }
+    }
+
+    FXxHash64Builder Builder;
+    UpdateName(Builder, Graph->GetFName());
+    UpdateObjectPath(Builder, Graph->Schema.Get());
+    const uint64 Hash = HashSorted(Builder, ContentHashes);
+    GraphHashes.Add(Graph, Hash);
+    return Hash;
+}
+
+uint64 FGeoBlueprintJsonContentHasher::HashBlueprint(UBlueprint* Blueprint)
+{
+    using namespace GeoBlueprintJsonContentHash;
+
+    if (!Blueprint)
+    {
+        return 0;
+    }
+
+    FXxHash64Builder Builder;
+    UpdateObjectPath(Builder, Blueprint->GetClass());
+    UpdateObjectPath(Builder, Blueprint->ParentClass);
+    FGeoBlueprintJsonGraphExporter::ForEachExportedGraph(Blueprint, [this, &Builder](UEdGraph* Graph, const TCHAR* GraphType)
+    {
+        UpdateString(Builder, GraphType);
+        UpdateValue(Builder, HashGraph(Graph));
+    });
+    return Builder.Finalize().Hash;
+}
@@ -0,0 +1,92 @@
+#include "GeoBlueprintJsonEditorInvalidation.h"
+#include "Editor.h"
+#include "Internationalization/Internationalization.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/UObjectGlobals.h"
+
+FGeoBlueprintJsonEditorInvalidation& FGeoBlueprintJsonEditorInvalidation::Get()
+{
+    static FGeoBlueprintJsonEditorInvalidation Invalidation;
+    return Invalidation;
+}
+
+void FGeoBlueprintJsonEditorInvalidation::Register()
+{
+    if (ObjectModifiedHandle.IsValid())
+    {
+        return;
+    }
+
+    ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FGeoBlueprintJsonEditorInvalidation::HandleObjectModified);
+    PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FGeoBlueprintJsonEditorInvalidation::HandleObjectPropertyChanged);
+    PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FGeoBlueprintJsonEditorInvalidation::HandlePostGarbageCollect);
+    CultureChangedHandle = FInternationalization::Get().OnCultureChanged().AddRaw(this, &FGeoBlueprintJsonEditorInvalidation::HandleCultureChanged);
+
+    if (GEditor)
+    {
+        RegisterCompileHandler();
+    }
+    else
+    {
+        PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddRaw(this, &FGeoBlueprintJsonEditorInvalidation::RegisterCompileHandler);
+    }
+}
+
+void FGeoBlueprintJsonEditorInvalidation::RegisterCompileHandler()
+{
+    if (GEditor && !BlueprintCompiledHandle.IsValid())
+    {
+        BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(this, &FGeoBlueprintJsonEditorInvalidation::HandleBlueprintCompiled);
+    }
+}
+
+void FGeoBlueprintJsonEditorInvalidation::Unregister()
+{
+    FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+    FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+    FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+    if (FInternationalization::IsAvailable())
+    {
+        FInternationalization::Get().OnCultureChanged().Remove(CultureChangedHandle);
+    }
+    if (GEditor)
+    {
+        GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+    }
+
+    ObjectModifiedHandle.Reset();
+    PropertyChangedHandle.Reset();
+    PostGarbageCollectHandle.Reset();
+    CultureChangedHandle.Reset();
+    PostEngineInitHandle.Reset();
+    BlueprintCompiledHandle.Reset();
+}
+
+void FGeoBlueprintJsonEditorInvalidation::HandleObjectModified(UObject* Object)
+{
+    if (Object)
+    {
+        ObjectChangedDelegate.Broadcast(Object);
+    }
+}
+
+void FGeoBlueprintJsonEditorInvalidation::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+    HandleObjectModified(Object);
+}
+
+void FGeoBlueprintJsonEditorInvalidation::HandleBlueprintCompiled()
+{
+    BlueprintCompiledDelegate.Broadcast();
+}
+
+void FGeoBlueprintJsonEditorInvalidation::HandleCultureChanged()
+{
+    CultureChangedDelegate.Broadcast();
+}
+
+void FGeoBlueprintJsonEditorInvalidation::HandlePostGarbageCollect()
+{
+    PostGarbageCollectDelegate.Broadcast();
+}
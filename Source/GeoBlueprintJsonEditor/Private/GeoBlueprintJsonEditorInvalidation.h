@@ -0,0 +1,64 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+struct FPropertyChangedEvent;
+
+/**
+ * The editor events that make the export caches stale, hooked once and rebroadcast to every cache.
+ * Objects report both Modify and property edits as changed. A Blueprint compile is reported once the
+ * editor engine exists, since it doesn't yet when the module starts up with the editor. Caches that
+ * see IsRegistered() return false should keep nothing, as nothing would tell them to drop it.
+ * Game thread only.
+ */
+class FGeoBlueprintJsonEditorInvalidation
+{
+public:
+    DECLARE_MULTICAST_DELEGATE_OneParam(FOnObjectChanged, UObject*);
+
+    static FGeoBlueprintJsonEditorInvalidation& Get();
+
+    /** Called by the editor module */
+    void Register();
+    void Unregister();
+    bool IsRegistered() const { return ObjectModifiedHandle.IsValid(); }
+
+    FOnObjectChanged& OnObjectChanged() { return ObjectChangedDelegate; }
+    FSimpleMulticastDelegate& OnBlueprintCompiled() { return BlueprintCompiledDelegate; }
+    FSimpleMulticastDelegate& OnCultureChanged() { return CultureChangedDelegate; }
+    FSimpleMulticastDelegate& OnPostGarbageCollect() { return PostGarbageCollectDelegate; }
+
+    /** Keys of collected objects can never match again, so they only cost memory */
+    template <typename ObjectType, typename ValueType>
+    static void RemoveCollectedKeys(TMap<TObjectKey<ObjectType>, ValueType>& Map)
+    {
+        for (auto It = Map.CreateIterator(); It; ++It)
+        {
+            if (!It.Key().ResolveObjectPtr())
+            {
+                It.RemoveCurrent();
+            }
+        }
+    }
+
+private:
+    void RegisterCompileHandler();
+    void HandleObjectModified(UObject* Object);
+    void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+    void HandleBlueprintCompiled();
+    void HandleCultureChanged();
+    void HandlePostGarbageCollect();
+
+    FOnObjectChanged ObjectChangedDelegate;
+    FSimpleMulticastDelegate BlueprintCompiledDelegate;
+    FSimpleMulticastDelegate CultureChangedDelegate;
+    FSimpleMulticastDelegate PostGarbageCollectDelegate;
+
+    FDelegateHandle ObjectModifiedHandle;
+    FDelegateHandle PropertyChangedHandle;
+    FDelegateHandle PostGarbageCollectHandle;
+    FDelegateHandle CultureChangedHandle;
+    FDelegateHandle PostEngineInitHandle;
+    FDelegateHandle BlueprintCompiledHandle;
+};
@@ -0,0 +1,34 @@
+#include "GeoBlueprintJsonEditorModule.h"
+#include "GeoBlueprintJsonEditorInvalidation.h"
+#include "GeoBlueprintJsonExportServer.h"
+#include "GeoBlueprintJsonNodeGuidIndex.h"
+#include "GeoBlueprintJsonNodeTitleCache.h"
+#include "Modules/ModuleManager.h"
+
+#define LOCTEXT_NAMESPACE "FGeoBlueprintJsonEditorModule"
+
+void FGeoBlueprintJsonEditorModule::StartupModule()
+{
+    FGeoBlueprintJsonEditorInvalidation::Get().Register();
+    FGeoBlueprintJsonNodeTitleCache::Get().Register();
+    FGeoBlueprintJsonNodeGuidIndex::Get().Register();
+
+    // -GeoBlueprintJsonServer or -GeoBlueprintJsonServer=<Port> starts the export server with the editor
+    int32 ServerPort = FGeoBlueprintJsonExportServer::DefaultPort;
+    if (FParse::Value(FCommandLine::Get(), TEXT("GeoBlueprintJsonServer="), ServerPort) || FParse::Param(FCommandLine::Get(), TEXT("GeoBlueprintJsonServer")))
+    {
+        FGeoBlueprintJsonExportServer::Get().Start(ServerPort);
+    }
+}
+
+void FGeoBlueprintJsonEditorModule::ShutdownModule()
+{
+    FGeoBlueprintJsonExportServer::Get().Stop();
+    FGeoBlueprintJsonNodeGuidIndex::Get().Unregister();
+    FGeoBlueprintJsonNodeTitleCache::Get().Unregister();
+    FGeoBlueprintJsonEditorInvalidation::Get().Unregister();
+}
+
+#undef LOCTEXT_NAMESPACE
+
+IMPLEMENT_MODULE(FGeoBlueprintJsonEditorModule, GeoBlueprintJsonEditor)
@@ -0,0 +1,163 @@
+#include "GeoBlueprintJsonExportCommandlet.h"
+#include "GeoBlueprintJsonBulkExporter.h"
+#include "GeoBlueprintJsonCompileProfiler.h"
+#include "GeoBlueprintJsonExportServer.h"
+#include "GeoBlueprintJsonGraphFunctionLibrary.h"
+#include "GeoBlueprintJsonShardCoordinator.h"
+#include "Containers/Ticker.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/CoreMisc.h"
+
+UGeoBlueprintJsonExportCommandlet::UGeoBlueprintJsonExportCommandlet()
+{
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 UGeoBlueprintJsonExportCommandlet::Main(const FString& Params)
+{
+    if (FParse::Param(*Params, TEXT("Serve")))
+    {
+        return Serve(Params);
+    }
+
+    FGeoBlueprintJsonBulkExportSettings Settings;
+    if (!FParse::Value(*Params, TEXT("Output="), Settings.OutputDirectory))
+    {
+        UE_LOG(LogTemp, Error, TEXT("GeoBlueprintJsonExport requires -Output=<Directory>"));
+        return 1;
+    }
+
+    FString PathList;
+    if (FParse::Value(*Params, TEXT("Paths="), PathList, false))
+    {
+        Settings.PackagePaths.Reset();
+        PathList.ParseIntoArray(Settings.PackagePaths, TEXT(","));
+    }
+    // Report modes: rank every graph, actor Blueprint, Animation Blueprint, widget binding, replicated class, load closure or compile time instead of exporting them
+    const bool bGraphMetrics = FParse::Param(*Params, TEXT("GraphMetrics"));
+    const bool bComponentCosts = FParse::Param(*Params, TEXT("ComponentCosts"));
+    const bool bAnimAudit = FParse::Param(*Params, TEXT("AnimAudit"));
+    const bool bWidgetBindings = FParse::Param(*Params, TEXT("WidgetBindings"));
+    const bool bReplication = FParse::Param(*Params, TEXT("Replication"));
+    const bool bLoadCosts = FParse::Param(*Params, TEXT("LoadCosts"));
+    if (bGraphMetrics || bComponentCosts || bAnimAudit || bWidgetBindings || bReplication || bLoadCosts || FParse::Param(*Params, TEXT("CompileTimes")))
+    {
+        int32 MaxResults = 0;
+        FParse::Value(*Params, TEXT("MaxResults="), MaxResults);
+
+        FString Report;
+        const TCHAR* ReportFile = nullptr;
+        if (bGraphMetrics)
+        {
+            Report = UGeoBlueprintJsonGraphFunctionLibrary::RankGraphMetrics(Settings.PackagePaths, MaxResults);
+            ReportFile = TEXT("GraphMetrics.json");
+        }
+        else if (bComponentCosts)
+        {
+            Report = UGeoBlueprintJsonGraphFunctionLibrary::RankComponentCosts(Settings.PackagePaths, MaxResults);
+            ReportFile = TEXT("ComponentCosts.json");
+        }
+        else if (bAnimAudit)
+        {
+            Report = UGeoBlueprintJsonGraphFunctionLibrary::RankAnimBlueprints(Settings.PackagePaths, MaxResults);
+            ReportFile = TEXT("AnimAudit.json");
+        }
+        else if (bWidgetBindings)
+        {
+            Report = UGeoBlueprintJsonGraphFunctionLibrary::RankWidgetBindings(Settings.PackagePaths, MaxResults);
+            ReportFile = TEXT("WidgetBindings.json");
+        }
+        else if (bReplication)
+        {
+            Report = UGeoBlueprintJsonGraphFunctionLibrary::RankReplicationCosts(Settings.PackagePaths, MaxResults);
+            ReportFile = TEXT("Replication.json");
+        }
+        else if (bLoadCosts)
+        {
+            Report = UGeoBlueprintJsonGraphFunctionLibrary::RankLoadCosts(Settings.PackagePaths, MaxResults);
+            ReportFile = TEXT("LoadCosts.json");
+        }
+        else
+        {
+            int32 Iterations = FGeoBlueprintJsonCompileProfiler::DefaultIterations;
+            FParse::Value(*Params, TEXT("Iterations="), Iterations);
+            Report = UGeoBlueprintJsonGraphFunctionLibrary::RankBlueprintCompileTimes(Settings.PackagePaths, MaxResults, Iterations);
+            ReportFile = TEXT("CompileTimes.json");
+        }
+
+        const FString ReportPath = FPaths::Combine(Settings.OutputDirectory, ReportFile);
+        UE_LOG(LogTemp, Display, TEXT("GeoBlueprintJsonExport: writing %s"), *ReportPath);
+        return FFileHelper::SaveStringToFile(Report, *ReportPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM) ? 0 : 1;
+    }
+
+    FParse::Value(*Params, TEXT("MemoryBudgetMB="), Settings.MemoryBudgetMB);
+    FParse::Value(*Params, TEXT("PipelineDepth="), Settings.PipelineDepth);
+    Settings.bWriteJsonLines = FParse::Param(*Params, TEXT("JsonLines"));
+    Settings.bShareInheritedData = FParse::Param(*Params, TEXT("ShareInherited"));
+
+    // Worker mode: export exactly the packages the coordinator assigned to this shard
+    FString ShardListFile;
+    TArray<FAssetData> Assets;
+    if (FParse::Value(*Params, TEXT("ShardList="), ShardListFile))
+    {
+        TArray<FName> PackageNames;
+        if (!FGeoBlueprintJsonShardCoordinator::LoadShardList(ShardListFile, PackageNames))
+        {
+            UE_LOG(LogTemp, Error, TEXT("GeoBlueprintJsonExport could not read shard list %s"), *ShardListFile);
+            return 1;
+        }
+        Assets = FGeoBlueprintJsonBulkExporter::GatherBlueprintAssets(PackageNames);
+    }
+    else
+    {
+        Assets = FGeoBlueprintJsonBulkExporter::GatherBlueprintAssets(Settings);
+    }
+
+    // Coordinator mode: fan the export out to worker processes and merge their output
+    int32 NumShards = 0;
+    if (ShardListFile.IsEmpty() && FParse::Value(*Params, TEXT("Shards="), NumShards) && NumShards > 1)
+    {
+        int32 MaxRetries = 2;
+        FParse::Value(*Params, TEXT("MaxRetries="), MaxRetries);
+
+        UE_LOG(LogTemp, Display, TEXT("GeoBlueprintJsonExport: exporting %d Blueprints to %s with %d shards"), Assets.Num(), *Settings.OutputDirectory, NumShards);
+        FGeoBlueprintJsonShardCoordinator Coordinator(Settings, NumShards, MaxRetries);
+        const FGeoBlueprintJsonBulkExportResult Result = Coordinator.Run(Assets);
+        return Result.NumFailed == 0 ? 0 : 1;
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("GeoBlueprintJsonExport: exporting %d Blueprints to %s"), Assets.Num(), *Settings.OutputDirectory);
+
+    FGeoBlueprintJsonBulkExporter Exporter(Settings);
+    const FGeoBlueprintJsonBulkExportResult Result = Exporter.Run(Assets);
+    return Result.ManifestPath.IsEmpty() || !FPaths::FileExists(Result.ManifestPath) ? 1 : 0;
+}
+
+int32 UGeoBlueprintJsonExportCommandlet::Serve(const FString& Params)
+{
+    int32 Port = FGeoBlueprintJsonExportServer::DefaultPort;
+    FParse::Value(*Params, TEXT("Port="), Port);
+
+    FGeoBlueprintJsonExportServer& Server = FGeoBlueprintJsonExportServer::Get();
+    if (!Server.Start(Port))
+    {
+        return 1;
+    }
+
+    // Commandlets have no engine loop, so the ticker that converts cache misses is pumped here
+    double LastTime = FPlatformTime::Seconds();
+    while (Server.IsRunning() && !IsEngineExitRequested())
+    {
+        const double Now = FPlatformTime::Seconds();
+        FTSTicker::GetCoreTicker().Tick(static_cast<float>(Now - LastTime));
+        LastTime = Now;
+        FPlatformProcess::Sleep(0.001f);
+    }
+
+    Server.Stop();
+    return 0;
+}
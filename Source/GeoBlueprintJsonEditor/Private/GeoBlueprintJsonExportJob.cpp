@@ -0,0 +1,488 @@
+#include "GeoBlueprintJsonExportJob.h"
+#include "GeoBlueprintJsonBulkExporter.h"
+#include "GeoBlueprintJsonDom.h"
+#include "GeoBlueprintJsonGraphExporter.h"
+#include "GeoBlueprintJsonPackageTracker.h"
+#include "Animation/AnimBlueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Tasks/Task.h"
+#include "UObject/Package.h"
+
+namespace GeoBlueprintJsonExportJob
+{
+    /** Finished assets waiting on their encode before the job stops gathering; each holds a whole DOM */
+    static constexpr int32 MaxPendingEncodes = 4;
+
+    /** The job started from the console, so it can be cancelled from there */
+    static TWeakPtr<FGeoBlueprintJsonExportJob> ConsoleJob;
+
+    static FAutoConsoleCommand StartCommand(
+        TEXT("GeoBlueprintJson.Export.Start"),
+        TEXT("Exports the Blueprints under a package path (default /Game) to a directory within a per-frame budget: <OutputDirectory> [PackagePath] [BudgetMs]"),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            if (Args.Num() < 1)
+            {
+                UE_LOG(LogTemp, Error, TEXT("GeoBlueprintJson.Export.Start needs an output directory"));
+                return;
+            }
+            if (const TSharedPtr<FGeoBlueprintJsonExportJob> RunningJob = ConsoleJob.Pin(); RunningJob && RunningJob->IsRunning())
+            {
+                UE_LOG(LogTemp, Error, TEXT("A time-sliced export is already running; cancel it with GeoBlueprintJson.Export.Cancel"));
+                return;
+            }
+
+            FGeoBlueprintJsonBulkExportSettings Settings;
+            if (Args.Num() > 1)
+            {
+                Settings.PackagePaths = { Args[1] };
+            }
+            const float BudgetMs = Args.Num() > 2 ? FCString::Atof(*Args[2]) : FGeoBlueprintJsonExportJob::DefaultBudgetMs;
+
+            const TSharedRef<FGeoBlueprintJsonExportJob> Job = MakeShared<FGeoBlueprintJsonExportJob>(
+                FGeoBlueprintJsonBulkExporter::GatherBlueprintAssets(Settings), Args[0], FGeoBlueprintJsonGraphExportOptions(), BudgetMs);
+            ConsoleJob = Job;
+            Job->Start();
+        }));
+
+    static FAutoConsoleCommand CancelCommand(
+        TEXT("GeoBlueprintJson.Export.Cancel"),
+        TEXT("Cancels the time-sliced export started from the console"),
+        FConsoleCommandDelegate::CreateLambda([]()
+        {
+            if (const TSharedPtr<FGeoBlueprintJsonExportJob> Job = ConsoleJob.Pin())
+            {
+                Job->Cancel();
+            }
+        }));
+}
+
+/** A finished asset whose DOM is encoded and written on a worker; the DOM holds no UObject references */
+struct FGeoBlueprintJsonExportJob::FEncode
+{
+    FAssetData AssetData;
+    TUniquePtr<FGeoJsonArena> Arena;
+    FGeoJsonObject* BlueprintObject = nullptr;
+    TArray<uint8> Bytes;
+    bool bWritten = false;
+    UE::Tasks::FTask Task;
+};
+
+FGeoBlueprintJsonExportJob::FGeoBlueprintJsonExportJob(TArray<FAssetData> InAssets, const FString& InOutputDirectory,
+    const FGeoBlueprintJsonGraphExportOptions& InOptions, float InBudgetMs)
+    : Assets(MoveTemp(InAssets))
+    , OutputDirectory(InOutputDirectory)
+    , Options(InOptions)
+    , LoadedPackages(MakeUnique<FGeoBlueprintJsonPackageTracker>())
+{
+    SetBudgetMs(InBudgetMs);
+    Progress.NumAssets = Assets.Num();
+}
+
+FGeoBlueprintJsonExportJob::~FGeoBlueprintJsonExportJob()
+{
+    // Workers write into encodes this job owns
+    for (const TUniquePtr<FEncode>& Encode : Encodes)
+    {
+        Encode->Task.Wait();
+    }
+}
+
+void FGeoBlueprintJsonExportJob::Start()
+{
+    check(IsInGameThread());
+    if (IsRunning())
+    {
+        return;
+    }
+
+    ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddSP(this, &FGeoBlueprintJsonExportJob::OnObjectModified);
+    if (GEditor)
+    {
+        PreCompileHandle = GEditor->OnBlueprintPreCompile().AddSP(this, &FGeoBlueprintJsonExportJob::OnBlueprintPreCompile);
+    }
+
+    BeginAsset();
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([This = AsShared()](float DeltaTime)
+    {
+        return This->Tick(DeltaTime);
+    }));
+
+    UE_LOG(LogTemp, Display, TEXT("Time-sliced export of %d assets started with a %.1f ms budget per frame"), Assets.Num(), BudgetMs);
+}
+
+void FGeoBlueprintJsonExportJob::Cancel()
+{
+    check(IsInGameThread());
+    if (!IsRunning())
+    {
+        return;
+    }
+
+    // Removing the ticker drops the reference it held
+    const TSharedRef<FGeoBlueprintJsonExportJob> KeepAlive = AsShared();
+    FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+    TickerHandle.Reset();
+
+    for (const TUniquePtr<FEncode>& Encode : Encodes)
+    {
+        Encode->Task.Wait();
+    }
+    CollectEncodes();
+    Finish(true);
+}
+
+bool FGeoBlueprintJsonExportJob::Tick(float DeltaTime)
+{
+    // Finishing removes the ticker, and with it the reference the ticker held
+    const TSharedRef<FGeoBlueprintJsonExportJob> KeepAlive = AsShared();
+
+    const double StartTime = FPlatformTime::Seconds();
+    const double Deadline = StartTime + BudgetMs / 1000.0;
+
+    CollectEncodes();
+    while (IsRunning() && Step() && FPlatformTime::Seconds() < Deadline)
+    {
+    }
+
+    // A delegate may have cancelled the job
+    if (!IsRunning())
+    {
+        return false;
+    }
+
+    Progress.LastFrameMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    Progress.TotalGameThreadMs += Progress.LastFrameMs;
+    ProgressDelegate.Broadcast(Progress);
+
+    if (IsRunning() && AssetIndex >= Assets.Num() && Encodes.Num() == 0)
+    {
+        Finish(false);
+    }
+    return IsRunning();
+}
+
+bool FGeoBlueprintJsonExportJob::Step()
+{
+    if (bRestartRequested)
+    {
+        RestartAsset();
+    }
+
+    // The Blueprint was garbage collected or replaced by a reload
+    if ((Stage == EStage::Header || Stage == EStage::Analyses || Stage == EStage::Graphs) && !Blueprint.IsValid())
+    {
+        RestartAsset();
+    }
+
+    switch (Stage)
+    {
+    case EStage::Load:
+        return StepLoad();
+    case EStage::Header:
+        StepHeader();
+        return true;
+    case EStage::Analyses:
+        StepAnalyses();
+        return true;
+    case EStage::Graphs:
+        StepGraphs();
+        return true;
+    case EStage::Encode:
+        return StepEncode();
+    }
+    return false;
+}
+
+bool FGeoBlueprintJsonExportJob::StepLoad()
+{
+    if (!Assets.IsValidIndex(AssetIndex) || (bLoadRequested && !bLoadFinished))
+    {
+        return false;
+    }
+
+    const FAssetData& AssetData = Assets[AssetIndex];
+    UBlueprint* LoadedBlueprint = Cast<UBlueprint>(AssetData.FastGetAsset(false));
+    if (LoadedBlueprint && !LoadedBlueprint->HasAnyFlags(RF_NeedLoad | RF_NeedPostLoad))
+    {
+        Blueprint = LoadedBlueprint;
+        Stage = EStage::Header;
+        return true;
+    }
+
+    if (!bLoadRequested)
+    {
+        // Recording stops when the load finishes and keeps only this package and what it imports
+        bLoadRequested = true;
+        LoadedPackages->StartRecording();
+        LoadPackageAsync(AssetData.PackageName.ToString(), FLoadPackageAsyncDelegate::CreateSP(this, &FGeoBlueprintJsonExportJob::OnPackageLoaded));
+        return false;
+    }
+
+    UE_LOG(LogTemp, Warning, TEXT("Time-sliced export could not load %s"), *AssetData.GetObjectPathString());
+    FailAsset();
+    return true;
+}
+
+void FGeoBlueprintJsonExportJob::StepHeader()
+{
+    UBlueprint* LoadedBlueprint = Blueprint.Get();
+    if (Arena)
+    {
+        Arena->Reset();
+    }
+    else
+    {
+        Arena = MakeUnique<FGeoJsonArena>();
+    }
+    Exporter = MakeUnique<FGeoBlueprintJsonGraphExporter>(*Arena, Options);
+
+    BlueprintObject = Exporter->BeginBlueprintHeaderObject(LoadedBlueprint);
+    if (!BlueprintObject)
+    {
+        FailAsset();
+        return;
+    }
+    AnalysisIndex = 0;
+    Stage = EStage::Analyses;
+}
+
+void FGeoBlueprintJsonExportJob::StepAnalyses()
+{
+    UBlueprint* LoadedBlueprint = Blueprint.Get();
+    if (AnalysisIndex < static_cast<int32>(FGeoBlueprintJsonGraphExporter::EHeaderAnalysis::Num))
+    {
+        Exporter->AddHeaderAnalysis(*BlueprintObject, LoadedBlueprint, static_cast<FGeoBlueprintJsonGraphExporter::EHeaderAnalysis>(AnalysisIndex));
+        ++AnalysisIndex;
+        return;
+    }
+
+    // The arrays BuildBlueprintObject adds, filled one graph at a time by StepGraphs
+    BlueprintObject->SetArrayField(TEXT("EventGraphs"));
+    BlueprintObject->SetArrayField(TEXT("FunctionGraphs"));
+    BlueprintObject->SetArrayField(TEXT("MacroGraphs"));
+    BlueprintObject->SetArrayField(TEXT("DelegateGraphs"));
+    if (LoadedBlueprint->IsA<UAnimBlueprint>())
+    {
+        BlueprintObject->SetArrayField(TEXT("AnimGraphs"));
+    }
+
+    Graphs.Reset();
+    FGeoBlueprintJsonGraphExporter::ForEachExportedGraph(LoadedBlueprint, [this](UEdGraph* Graph, const TCHAR* GraphType)
+    {
+        Graphs.Emplace(Graph, GraphType);
+    });
+    GraphIndex = 0;
+    NodeIndex = 0;
+    Stage = EStage::Graphs;
+}
+
+void FGeoBlueprintJsonExportJob::StepGraphs()
+{
+    if (!Graphs.IsValidIndex(GraphIndex))
+    {
+        Exporter->AddBlueprintContentHash(*BlueprintObject, Blueprint.Get());
+        Stage = EStage::Encode;
+        return;
+    }
+
+    UEdGraph* Graph = Graphs[GraphIndex].Key.Get();
+    if (!Graph)
+    {
+        RestartAsset();
+        return;
+    }
+
+    if (!GraphObject)
+    {
+        const TCHAR* GraphType = Graphs[GraphIndex].Value;
+        GraphObject = Exporter->BeginGraphObject(Graph, GraphType, NodesArray);
+
+        const FGeoJsonValue* GraphsValue = BlueprintObject->FindField(FGeoBlueprintJsonGraphExporter::GetGraphArrayName(GraphType));
+        if (GraphsValue && GraphsValue->Type == EGeoJsonType::Array)
+        {
+            GraphsValue->Array->AddObject(GraphObject);
+        }
+        NodeIndex = 0;
+        return;
+    }
+
+    if (Graph->Nodes.IsValidIndex(NodeIndex))
+    {
+        if (FGeoJsonObject* NodeObject = Exporter->BuildNodeObject(Graph->Nodes[NodeIndex]))
+        {
+            NodesArray->AddObject(NodeObject);
+            ++Progress.NumNodesExported;
+        }
+        ++NodeIndex;
+        return;
+    }
+
+    Exporter->FinishGraphObject(*GraphObject, Graph);
+    GraphObject = nullptr;
+    NodesArray = nullptr;
+    ++GraphIndex;
+}
+
+bool FGeoBlueprintJsonExportJob::StepEncode()
+{
+    if (Encodes.Num() >= GeoBlueprintJsonExportJob::MaxPendingEncodes)
+    {
+        return false;
+    }
+
+    TUniquePtr<FEncode> Encode = MakeUnique<FEncode>();
+    Encode->AssetData = Assets[AssetIndex];
+    Encode->BlueprintObject = BlueprintObject;
+    Exporter.Reset();
+    Encode->Arena = MoveTemp(Arena);
+
+    FEncode* EncodePtr = Encode.Get();
+    FString FilePath = OutputDirectory.IsEmpty() ? FString() : FPaths::Combine(OutputDirectory, FGeoBlueprintJsonBulkExporter::GetRelativeOutputPath(Encode->AssetData));
+    EncodePtr->Task = UE::Tasks::Launch(UE_SOURCE_LOCATION, [EncodePtr, FilePath = MoveTemp(FilePath)]()
+    {
+        EncodePtr->BlueprintObject->SerializeUtf8(EncodePtr->Bytes);
+        EncodePtr->bWritten = FilePath.IsEmpty() || FFileHelper::SaveArrayToFile(EncodePtr->Bytes, *FilePath);
+    });
+    Encodes.Add(MoveTemp(Encode));
+
+    NextAsset();
+    return true;
+}
+
+void FGeoBlueprintJsonExportJob::CollectEncodes()
+{
+    // Taken off the queue first, so a delegate that cancels the job doesn't see them again
+    TArray<TUniquePtr<FEncode>> Collected;
+    while (Encodes.Num() > 0 && Encodes[0]->Task.IsCompleted())
+    {
+        Collected.Add(MoveTemp(Encodes[0]));
+        Encodes.RemoveAt(0);
+    }
+
+    for (const TUniquePtr<FEncode>& Encode : Collected)
+    {
+        if (Encode->bWritten)
+        {
+            ++Progress.NumExported;
+            AssetExportedDelegate.Broadcast(Encode->AssetData, Encode->Bytes);
+        }
+        else
+        {
+            ++Progress.NumFailed;
+            UE_LOG(LogTemp, Error, TEXT("Time-sliced export could not write %s"), *Encode->AssetData.GetObjectPathString());
+        }
+    }
+}
+
+void FGeoBlueprintJsonExportJob::BeginAsset()
+{
+    Stage = EStage::Load;
+    bLoadRequested = false;
+    bLoadFinished = false;
+    bRestartRequested = false;
+    LoadedPackages->StopRecording();
+    Blueprint.Reset();
+    AnalysisIndex = 0;
+    Graphs.Reset();
+    GraphIndex = 0;
+    NodeIndex = 0;
+
+    // The arena is kept for the next attempt; one handed to an encode was replaced by null
+    Exporter.Reset();
+    BlueprintObject = nullptr;
+    GraphObject = nullptr;
+    NodesArray = nullptr;
+
+    Progress.CurrentAsset = Assets.IsValidIndex(AssetIndex) ? Assets[AssetIndex].GetSoftObjectPath() : FSoftObjectPath();
+}
+
+void FGeoBlueprintJsonExportJob::RestartAsset()
+{
+    ++Progress.NumRestarts;
+    if (++NumAssetRestarts > MaxRestartsPerAsset)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Time-sliced export gives up on %s after it changed %d times"), *Progress.CurrentAsset.ToString(), NumAssetRestarts);
+        ++Progress.NumRestartLimitFailures;
+        FailAsset();
+        return;
+    }
+
+    UE_LOG(LogTemp, Verbose, TEXT("Time-sliced export restarts %s after it changed"), *Progress.CurrentAsset.ToString());
+    BeginAsset();
+}
+
+void FGeoBlueprintJsonExportJob::FailAsset()
+{
+    ++Progress.NumFailed;
+    NextAsset();
+}
+
+void FGeoBlueprintJsonExportJob::NextAsset()
+{
+    // The encode only holds the asset's DOM, so nothing needs its packages any more
+    LoadedPackages->ReleasePackages();
+    NumAssetRestarts = 0;
+    ++AssetIndex;
+    BeginAsset();
+}
+
+void FGeoBlueprintJsonExportJob::Finish(bool bCancelled)
+{
+    FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+    FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+    if (GEditor)
+    {
+        GEditor->OnBlueprintPreCompile().Remove(PreCompileHandle);
+    }
+    TickerHandle.Reset();
+    ObjectModifiedHandle.Reset();
+    PreCompileHandle.Reset();
+
+    BeginAsset();
+    LoadedPackages->ReleasePackages();
+    Arena.Reset();
+    Progress.CurrentAsset.Reset();
+
+    UE_LOG(LogTemp, Display, TEXT("Time-sliced export %s: %d exported, %d failed, %d restarts, %.1f ms of game thread time"),
+        bCancelled ? TEXT("cancelled") : TEXT("finished"), Progress.NumExported, Progress.NumFailed, Progress.NumRestarts, Progress.TotalGameThreadMs);
+
+    (bCancelled ? CancelledDelegate : CompletedDelegate).Broadcast(Progress);
+}
+
+bool FGeoBlueprintJsonExportJob::IsCurrentPackage(const UObject* Object) const
+{
+    return Object && Assets.IsValidIndex(AssetIndex) && Object->GetPackage()->GetFName() == Assets[AssetIndex].PackageName;
+}
+
+void FGeoBlueprintJsonExportJob::OnObjectModified(UObject* Object)
+{
+    // Nothing has been read from the asset while it loads
+    if (Stage != EStage::Load && Object && !Object->HasAnyFlags(RF_Transient) && IsCurrentPackage(Object))
+    {
+        bRestartRequested = true;
+    }
+}
+
+void FGeoBlueprintJsonExportJob::OnBlueprintPreCompile(UBlueprint* CompiledBlueprint)
+{
+    if (Stage != EStage::Load && IsCurrentPackage(CompiledBlueprint))
+    {
+        bRestartRequested = true;
+    }
+}
+
+void FGeoBlueprintJsonExportJob::OnPackageLoaded(const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result)
+{
+    // Loads requested for an asset the job has since moved past are ignored
+    if (Stage == EStage::Load && Assets.IsValidIndex(AssetIndex) && Assets[AssetIndex].PackageName == PackageName)
+    {
+        bLoadFinished = true;
+        LoadedPackages->StopRecording(PackageName);
+    }
+}
@@ -0,0 +1,870 @@
+#include "GeoBlueprintJsonExportServer.h"
+#include "GeoBlueprintJsonDom.h"
+#include "GeoBlueprintJsonFunctionLibrary.h"
+#include "GeoBlueprintJsonGraphExporter.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Async/Async.h"
+#include "Common/TcpSocketBuilder.h"
+#include "Dom/JsonObject.h"
+#include "EdGraph/EdGraph.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "Misc/CoreDelegates.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "SocketSubsystem.h"
+#include "Sockets.h"
+#include "UObject/Package.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace GeoBlueprintJsonExportServer
+{
+    /** A client sending a longer line without a newline is dropped */
+    static constexpr int32 MaxRequestBytes = 1024 * 1024;
+
+    /** Converted results kept before the cache starts evicting */
+    static constexpr int64 MaxCacheBytes = 512ll * 1024 * 1024;
+
+    /** Game thread time spent on cache misses per tick */
+    static constexpr double TickBudgetSeconds = 0.02;
+
+    static FAutoConsoleCommand StartCommand(
+        TEXT("GeoBlueprintJson.Server.Start"),
+        TEXT("Starts the local export server, optionally on the given port"),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            const int32 Port = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : FGeoBlueprintJsonExportServer::DefaultPort;
+            FGeoBlueprintJsonExportServer::Get().Start(Port);
+        }));
+
+    static FAutoConsoleCommand StopCommand(
+        TEXT("GeoBlueprintJson.Server.Stop"),
+        TEXT("Stops the local export server"),
+        FConsoleCommandDelegate::CreateLambda([]()
+        {
+            FGeoBlueprintJsonExportServer::Get().Stop();
+        }));
+
+    static FAutoConsoleCommand FlushCommand(
+        TEXT("GeoBlueprintJson.Server.Flush"),
+        TEXT("Drops every result the local export server has cached"),
+        FConsoleCommandDelegate::CreateLambda([]()
+        {
+            FGeoBlueprintJsonExportServer::Get().InvalidateAll();
+        }));
+
+    static void CloseSocket(FSocket* Socket)
+    {
+        if (Socket)
+        {
+            Socket->Close();
+            ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+        }
+    }
+
+    static void AppendUtf8(TArray<uint8>& Bytes, const ANSICHAR* Text)
+    {
+        Bytes.Append(reinterpret_cast<const uint8*>(Text), FCStringAnsi::Strlen(Text));
+    }
+
+    /** Pretty JSON from the FString based exports, as condensed UTF-8 that fits on one response line */
+    static void CondenseJson(const FString& Json, TArray<uint8>& OutBytes)
+    {
+        FString Condensed;
+        Condensed.Reserve(Json.Len());
+
+        bool bInString = false;
+        bool bEscaped = false;
+        for (const TCHAR Char : Json)
+        {
+            if (bInString)
+            {
+                bInString = bEscaped || Char != TEXT('"');
+                bEscaped = !bEscaped && Char == TEXT('\\');
+            }
+            else if (Char == TEXT(' ') || Char == TEXT('\t') || Char == TEXT('\r') || Char == TEXT('\n'))
+            {
+                continue;
+            }
+            else
+            {
+                bInString = Char == TEXT('"');
+            }
+            Condensed.AppendChar(Char);
+        }
+
+        const FTCHARToUTF8 Utf8(*Condensed, Condensed.Len());
+        OutBytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+    }
+
+    /** Missing fields read as empty, without the error FJsonObject::GetStringField logs */
+    static FString GetOptionalString(const FJsonObject& Object, const TCHAR* FieldName)
+    {
+        FString Value;
+        Object.TryGetStringField(FieldName, Value);
+        return Value;
+    }
+
+    /** Missing fields read as the default, without the error FJsonObject::GetIntegerField logs */
+    static int32 GetOptionalInt(const FJsonObject& Object, const TCHAR* FieldName, int32 Default)
+    {
+        int32 Value = Default;
+        Object.TryGetNumberField(FieldName, Value);
+        return Value;
+    }
+
+    /** Missing fields read as Both; unknown names fail */
+    template <typename EnumType>
+    static bool GetOptionalEnum(const FJsonObject& Object, const TCHAR* FieldName, EnumType& OutValue)
+    {
+        const FString Name = GetOptionalString(Object, FieldName);
+        const int64 Value = Name.IsEmpty() ? static_cast<int64>(EnumType::Both) : StaticEnum<EnumType>()->GetValueByNameString(Name);
+        OutValue = static_cast<EnumType>(Value);
+        return Value != INDEX_NONE;
+    }
+
+    /** The package a result was converted from and the packages it references, any of which changing makes the result stale */
+    static TArray<FName> GetSourcePackages(FName PackageName)
+    {
+        TArray<FName> PackageNames;
+        if (!PackageName.IsNone())
+        {
+            IAssetRegistry::GetChecked().GetDependencies(PackageName, PackageNames, UE::AssetRegistry::EDependencyCategory::Package);
+            PackageNames.RemoveAllSwap([](FName Dependency) { return FPackageName::IsScriptPackage(Dependency.ToString()); });
+        }
+        PackageNames.AddUnique(PackageName);
+        return PackageNames;
+    }
+
+    /** Accepts package names as well as object paths, so /Game/BP_Door means /Game/BP_Door.BP_Door */
+    static FSoftObjectPath MakeObjectPath(const FString& Path)
+    {
+        if (!Path.IsEmpty() && !Path.Contains(TEXT(".")))
+        {
+            return FSoftObjectPath(Path + TEXT(".") + FPackageName::GetShortName(Path));
+        }
+        return FSoftObjectPath(Path);
+    }
+}
+
+FGeoBlueprintJsonExportServer& FGeoBlueprintJsonExportServer::Get()
+{
+    static FGeoBlueprintJsonExportServer Server;
+    return Server;
+}
+
+bool FGeoBlueprintJsonExportServer::Start(int32 InPort)
+{
+    check(IsInGameThread());
+
+    if (bRunning)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("GeoBlueprintJson export server is already listening on port %d"), Port);
+        return Port == InPort;
+    }
+    Stop();
+
+    Port = InPort;
+    ListenSocket = FTcpSocketBuilder(TEXT("GeoBlueprintJsonExportServer"))
+        .AsReusable()
+        .AsNonBlocking()
+        .BoundToEndpoint(FIPv4Endpoint(FIPv4Address(127, 0, 0, 1), Port))
+        .Listening(64)
+        .Build();
+    if (!ListenSocket)
+    {
+        UE_LOG(LogTemp, Error, TEXT("GeoBlueprintJson export server could not listen on 127.0.0.1:%d"), Port);
+        return false;
+    }
+
+    ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FGeoBlueprintJsonExportServer::OnObjectModified);
+    PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FGeoBlueprintJsonExportServer::OnObjectPropertyChanged);
+    PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddRaw(this, &FGeoBlueprintJsonExportServer::OnPackageSaved);
+    PackageReloadedHandle = FCoreUObjectDelegates::OnPackageReloaded.AddRaw(this, &FGeoBlueprintJsonExportServer::OnPackageReloaded);
+    ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddRaw(this, &FGeoBlueprintJsonExportServer::OnModulesChanged);
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+    AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FGeoBlueprintJsonExportServer::OnAssetRemoved);
+    AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FGeoBlueprintJsonExportServer::OnAssetRenamed);
+
+    // The editor engine doesn't exist yet when the server starts from the command line
+    if (GEditor)
+    {
+        RegisterCompileHandler();
+    }
+    else
+    {
+        PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddRaw(this, &FGeoBlueprintJsonExportServer::RegisterCompileHandler);
+    }
+
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FGeoBlueprintJsonExportServer::Tick));
+
+    bStopRequested = false;
+    bRunning = true;
+    ServerThread = Async(EAsyncExecution::Thread, [this]()
+    {
+        RunServer();
+    });
+
+    UE_LOG(LogTemp, Display, TEXT("GeoBlueprintJson export server listening on 127.0.0.1:%d"), Port);
+    return true;
+}
+
+void FGeoBlueprintJsonExportServer::RegisterCompileHandler()
+{
+    if (GEditor && !BlueprintPreCompileHandle.IsValid())
+    {
+        BlueprintPreCompileHandle = GEditor->OnBlueprintPreCompile().AddRaw(this, &FGeoBlueprintJsonExportServer::OnBlueprintPreCompile);
+    }
+}
+
+void FGeoBlueprintJsonExportServer::Stop()
+{
+    check(IsInGameThread());
+
+    bStopRequested = true;
+    if (ServerThread.IsValid())
+    {
+        ServerThread.Wait();
+        ServerThread = TFuture<void>();
+    }
+    bRunning = false;
+
+    GeoBlueprintJsonExportServer::CloseSocket(ListenSocket);
+    ListenSocket = nullptr;
+
+    FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+    FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+    UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+    FCoreUObjectDelegates::OnPackageReloaded.Remove(PackageReloadedHandle);
+    FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+    if (FModuleManager* ModuleManager = FModuleManager::TryGet())
+    {
+        ModuleManager->OnModulesChanged().Remove(ModulesChangedHandle);
+    }
+    if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry")))
+    {
+        AssetRegistryModule->Get().OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistryModule->Get().OnAssetRenamed().Remove(AssetRenamedHandle);
+    }
+    if (GEditor)
+    {
+        GEditor->OnBlueprintPreCompile().Remove(BlueprintPreCompileHandle);
+    }
+
+    TickerHandle.Reset();
+    ObjectModifiedHandle.Reset();
+    PropertyChangedHandle.Reset();
+    PackageSavedHandle.Reset();
+    PackageReloadedHandle.Reset();
+    PostEngineInitHandle.Reset();
+    ModulesChangedHandle.Reset();
+    AssetRemovedHandle.Reset();
+    AssetRenamedHandle.Reset();
+    BlueprintPreCompileHandle.Reset();
+
+    Requests.Empty();
+    Responses.Empty();
+    InvalidateAll();
+}
+
+void FGeoBlueprintJsonExportServer::RunServer()
+{
+    TArray<TUniquePtr<FClient>> Clients;
+    TArray<uint8> ReadBuffer;
+    ReadBuffer.SetNumUninitialized(64 * 1024);
+
+    while (!bStopRequested)
+    {
+        bool bDidWork = false;
+
+        const int32 NumClientsBefore = Clients.Num();
+        AcceptClients(Clients);
+        bDidWork |= Clients.Num() != NumClientsBefore;
+
+        for (TUniquePtr<FClient>& Client : Clients)
+        {
+            bDidWork |= ReadClient(*Client, ReadBuffer);
+        }
+
+        FResponse Response;
+        while (Responses.Dequeue(Response))
+        {
+            // The client may have gone while its request was converted
+            for (TUniquePtr<FClient>& Client : Clients)
+            {
+                if (Client->Id == Response.ClientId)
+                {
+                    Client->Outbox.Append(MoveTemp(Response.Bytes));
+                    break;
+                }
+            }
+        }
+
+        for (TUniquePtr<FClient>& Client : Clients)
+        {
+            bDidWork |= WriteClient(*Client);
+        }
+
+        Clients.RemoveAll([](const TUniquePtr<FClient>& Client)
+        {
+            if (Client->bDisconnected)
+            {
+                GeoBlueprintJsonExportServer::CloseSocket(Client->Socket);
+                return true;
+            }
+            return false;
+        });
+        NumClients = Clients.Num();
+
+        if (!bDidWork)
+        {
+            FPlatformProcess::Sleep(0.001f);
+        }
+    }
+
+    for (TUniquePtr<FClient>& Client : Clients)
+    {
+        GeoBlueprintJsonExportServer::CloseSocket(Client->Socket);
+    }
+    NumClients = 0;
+    bRunning = false;
+}
+
+void FGeoBlueprintJsonExportServer::AcceptClients(TArray<TUniquePtr<FClient>>& Clients)
+{
+    bool bHasPendingConnection = false;
+    while (ListenSocket->HasPendingConnection(bHasPendingConnection) && bHasPendingConnection)
+    {
+        FSocket* Socket = ListenSocket->Accept(TEXT("GeoBlueprintJsonExportClient"));
+        if (!Socket)
+        {
+            break;
+        }
+        Socket->SetNonBlocking(true);
+        Socket->SetNoDelay(true);
+
+        TUniquePtr<FClient>& Client = Clients.Add_GetRef(MakeUnique<FClient>());
+        Client->Id = NextClientId++;
+        Client->Socket = Socket;
+    }
+}
+
+bool FGeoBlueprintJsonExportServer::ReadClient(FClient& Client, TArray<uint8>& ReadBuffer)
+{
+    if (Client.bDisconnected)
+    {
+        return false;
+    }
+
+    // Recv fails when the peer has closed the connection and reads nothing when there is no data yet
+    bool bDidWork = false;
+    int32 BytesRead = 0;
+    while (true)
+    {
+        if (!Client.Socket->Recv(ReadBuffer.GetData(), ReadBuffer.Num(), BytesRead))
+        {
+            Client.bDisconnected = true;
+            break;
+        }
+        if (BytesRead <= 0)
+        {
+            break;
+        }
+        Client.Inbox.Append(ReadBuffer.GetData(), BytesRead);
+        bDidWork = true;
+    }
+
+    int32 LineStart = 0;
+    for (int32 Index = 0; Index < Client.Inbox.Num(); ++Index)
+    {
+        if (Client.Inbox[Index] != '\n')
+        {
+            continue;
+        }
+
+        int32 LineLength = Index - LineStart;
+        if (LineLength > 0 && Client.Inbox[Index - 1] == '\r')
+        {
+            --LineLength;
+        }
+        if (LineLength > 0)
+        {
+            const FUTF8ToTCHAR Line(reinterpret_cast<const ANSICHAR*>(Client.Inbox.GetData() + LineStart), LineLength);
+            HandleRequestLine(Client, FString(Line.Length(), Line.Get()));
+        }
+        LineStart = Index + 1;
+    }
+    Client.Inbox.RemoveAt(0, LineStart, EAllowShrinking::No);
+
+    if (Client.Inbox.Num() > GeoBlueprintJsonExportServer::MaxRequestBytes)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("GeoBlueprintJson export server dropped client %d after a request longer than %d bytes"), Client.Id, GeoBlueprintJsonExportServer::MaxRequestBytes);
+        Client.bDisconnected = true;
+    }
+    return bDidWork;
+}
+
+bool FGeoBlueprintJsonExportServer::WriteClient(FClient& Client)
+{
+    if (Client.bDisconnected || Client.OutboxOffset >= Client.Outbox.Num())
+    {
+        return false;
+    }
+
+    int32 BytesSent = 0;
+    if (!Client.Socket->Send(Client.Outbox.GetData() + Client.OutboxOffset, Client.Outbox.Num() - Client.OutboxOffset, BytesSent))
+    {
+        // A full send buffer is retried on the next pass
+        if (ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode() != SE_EWOULDBLOCK)
+        {
+            Client.bDisconnected = true;
+        }
+        return false;
+    }
+
+    Client.OutboxOffset += FMath::Max(BytesSent, 0);
+    if (Client.OutboxOffset >= Client.Outbox.Num())
+    {
+        Client.Outbox.Reset();
+        Client.OutboxOffset = 0;
+    }
+    return BytesSent > 0;
+}
+
+void FGeoBlueprintJsonExportServer::HandleRequestLine(FClient& Client, const FString& Line)
+{
+    TSharedPtr<FJsonObject> Object;
+    const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Line);
+    if (!FJsonSerializer::Deserialize(Reader, Object) || !Object.IsValid())
+    {
+        Client.Outbox.Append(MakeResponse(nullptr, nullptr, false, TEXT("Request is not a JSON object")));
+        return;
+    }
+
+    FRequest Request;
+    Request.ClientId = Client.Id;
+    Request.Id = Object->TryGetField(TEXT("Id"));
+    Request.Type = GeoBlueprintJsonExportServer::GetOptionalString(*Object, TEXT("Type"));
+    Request.bNoCache = Object->HasTypedField<EJson::Boolean>(TEXT("NoCache")) && Object->GetBoolField(TEXT("NoCache"));
+    Request.Object = Object;
+
+    // Requests that don't touch UObjects are answered here, without waiting for the game thread
+    if (Request.Type == TEXT("Ping"))
+    {
+        const TArray<uint8> Result = { 't', 'r', 'u', 'e' };
+        Client.Outbox.Append(MakeResponse(Request.Id, &Result, false, FString()));
+        return;
+    }
+    if (Request.Type == TEXT("Stats"))
+    {
+        FGeoJsonArena Arena(1024);
+        FGeoJsonObject Stats(Arena);
+        {
+            FScopeLock Lock(&CacheLock);
+            Stats.SetNumberField(TEXT("Entries"), Cache.Num());
+            Stats.SetNumberField(TEXT("Bytes"), CacheBytes);
+        }
+        Stats.SetNumberField(TEXT("Hits"), CacheHits);
+        Stats.SetNumberField(TEXT("Misses"), CacheMisses);
+        Stats.SetNumberField(TEXT("Clients"), NumClients);
+
+        TArray<uint8> Result;
+        Stats.SerializeUtf8(Result, false);
+        Client.Outbox.Append(MakeResponse(Request.Id, &Result, false, FString()));
+        return;
+    }
+    if (Request.Type == TEXT("Shutdown"))
+    {
+        const TArray<uint8> Result = { 't', 'r', 'u', 'e' };
+        Client.Outbox.Append(MakeResponse(Request.Id, &Result, false, FString()));
+        WriteClient(Client);
+        bStopRequested = true;
+        return;
+    }
+
+    if (Request.Type == TEXT("ExportGraph"))
+    {
+        Request.Key = FString::Printf(TEXT("ExportGraph|%s|%s"),
+            *GeoBlueprintJsonExportServer::MakeObjectPath(GeoBlueprintJsonExportServer::GetOptionalString(*Object, TEXT("Asset"))).ToString(),
+            *GeoBlueprintJsonExportServer::GetOptionalString(*Object, TEXT("Graph")));
+    }
+    else if (Request.Type == TEXT("ExportNeighborhood"))
+    {
+        Request.Key = FString::Printf(TEXT("ExportNeighborhood|%s|%s|%d|%s|%s"),
+            *GeoBlueprintJsonExportServer::MakeObjectPath(GeoBlueprintJsonExportServer::GetOptionalString(*Object, TEXT("Asset"))).ToString(),
+            *GeoBlueprintJsonExportServer::GetOptionalString(*Object, TEXT("Node")),
+            GeoBlueprintJsonExportServer::GetOptionalInt(*Object, TEXT("Hops"), 2),
+            *GeoBlueprintJsonExportServer::GetOptionalString(*Object, TEXT("Edges")),
+            *GeoBlueprintJsonExportServer::GetOptionalString(*Object, TEXT("Direction")));
+    }
+    else if (Request.Type == TEXT("Catalog"))
+    {
+        Request.Key = TEXT("Catalog");
+    }
+    else if (Request.Type == TEXT("PropertySnapshot"))
+    {
+        Request.Key = FString::Printf(TEXT("PropertySnapshot|%s"), *GeoBlueprintJsonExportServer::MakeObjectPath(GeoBlueprintJsonExportServer::GetOptionalString(*Object, TEXT("Object"))).ToString());
+    }
+    else
+    {
+        Client.Outbox.Append(MakeResponse(Request.Id, nullptr, false, FString::Printf(TEXT("Unknown request type '%s'"), *Request.Type)));
+        return;
+    }
+
+    if (!Request.bNoCache)
+    {
+        if (const TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> Cached = FindCached(Request.Key))
+        {
+            ++CacheHits;
+            Client.Outbox.Append(MakeResponse(Request.Id, Cached.Get(), true, FString()));
+            return;
+        }
+    }
+
+    Requests.Enqueue(MoveTemp(Request));
+}
+
+bool FGeoBlueprintJsonExportServer::Tick(float DeltaTime)
+{
+    if (!bRunning)
+    {
+        // A Shutdown request stopped the server thread; release everything else here
+        TickerHandle.Reset();
+        Stop();
+        return false;
+    }
+
+    const double Deadline = FPlatformTime::Seconds() + GeoBlueprintJsonExportServer::TickBudgetSeconds;
+    FRequest Request;
+    while (FPlatformTime::Seconds() < Deadline && Requests.Dequeue(Request))
+    {
+        ProcessRequest(Request);
+    }
+    return true;
+}
+
+void FGeoBlueprintJsonExportServer::ProcessRequest(const FRequest& Request)
+{
+    // An earlier request for the same key may have filled the cache since this one was queued
+    if (!Request.bNoCache)
+    {
+        if (const TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> Cached = FindCached(Request.Key))
+        {
+            ++CacheHits;
+            Responses.Enqueue({ Request.ClientId, MakeResponse(Request.Id, Cached.Get(), true, FString()) });
+            return;
+        }
+    }
+    ++CacheMisses;
+
+    TArray<uint8> Result;
+    FName PackageName;
+    bool bCacheable = true;
+    FString Error;
+
+    bool bSucceeded = false;
+    if (Request.Type == TEXT("ExportGraph"))
+    {
+        bSucceeded = ExportGraph(Request, Result, PackageName, Error);
+    }
+    else if (Request.Type == TEXT("ExportNeighborhood"))
+    {
+        bSucceeded = ExportNeighborhood(Request, Result, PackageName, Error);
+    }
+    else if (Request.Type == TEXT("Catalog"))
+    {
+        bSucceeded = ExportCatalog(Result, Error);
+    }
+    else if (Request.Type == TEXT("PropertySnapshot"))
+    {
+        bSucceeded = ExportPropertySnapshot(Request, Result, PackageName, bCacheable, Error);
+    }
+
+    Responses.Enqueue({ Request.ClientId, MakeResponse(Request.Id, bSucceeded ? &Result : nullptr, false, Error) });
+
+    if (bSucceeded && bCacheable && !Request.bNoCache)
+    {
+        AddCached(Request.Key, GeoBlueprintJsonExportServer::GetSourcePackages(PackageName), MoveTemp(Result));
+    }
+}
+
+bool FGeoBlueprintJsonExportServer::ExportGraph(const FRequest& Request, TArray<uint8>& OutResult, FName& OutPackageName, FString& OutError)
+{
+    const FSoftObjectPath AssetPath = GeoBlueprintJsonExportServer::MakeObjectPath(GeoBlueprintJsonExportServer::GetOptionalString(*Request.Object, TEXT("Asset")));
+    UBlueprint* Blueprint = Cast<UBlueprint>(AssetPath.TryLoad());
+    if (!Blueprint)
+    {
+        OutError = FString::Printf(TEXT("'%s' is not a Blueprint"), *AssetPath.ToString());
+        return false;
+    }
+    OutPackageName = Blueprint->GetPackage()->GetFName();
+
+    FGeoJsonArena Arena;
+    FGeoBlueprintJsonGraphExporter Exporter(Arena);
+    Exporter.SetHeatDataEnabled(false);
+
+    const FString GraphName = GeoBlueprintJsonExportServer::GetOptionalString(*Request.Object, TEXT("Graph"));
+    if (GraphName.IsEmpty())
+    {
+        Exporter.BuildBlueprintObject(Blueprint)->SerializeUtf8(OutResult, false);
+        return true;
+    }
+
+    FGeoJsonObject* GraphObject = nullptr;
+    FGeoBlueprintJsonGraphExporter::ForEachExportedGraph(Blueprint, [&](UEdGraph* Graph, const TCHAR* GraphType)
+    {
+        if (!GraphObject && FGeoBlueprintJsonGraphExporter::GetGraphPath(Graph) == GraphName)
+        {
+            GraphObject = Exporter.BuildGraphObject(Graph, GraphType);
+        }
+    });
+    if (!GraphObject)
+    {
+        OutError = FString::Printf(TEXT("'%s' has no graph named '%s'"), *AssetPath.ToString(), *GraphName);
+        return false;
+    }
+    GraphObject->SerializeUtf8(OutResult, false);
+    return true;
+}
+
+bool FGeoBlueprintJsonExportServer::ExportNeighborhood(const FRequest& Request, TArray<uint8>& OutResult, FName& OutPackageName, FString& OutError)
+{
+    const FSoftObjectPath AssetPath = GeoBlueprintJsonExportServer::MakeObjectPath(GeoBlueprintJsonExportServer::GetOptionalString(*Request.Object, TEXT("Asset")));
+    UBlueprint* Blueprint = Cast<UBlueprint>(AssetPath.TryLoad());
+    if (!Blueprint)
+    {
+        OutError = FString::Printf(TEXT("'%s' is not a Blueprint"), *AssetPath.ToString());
+        return false;
+    }
+    OutPackageName = Blueprint->GetPackage()->GetFName();
+
+    EGeoBlueprintJsonEdgeFilter EdgeFilter;
+    EGeoBlueprintJsonEdgeDirection Direction;
+    if (!GeoBlueprintJsonExportServer::GetOptionalEnum(*Request.Object, TEXT("Edges"), EdgeFilter)
+        || !GeoBlueprintJsonExportServer::GetOptionalEnum(*Request.Object, TEXT("Direction"), Direction))
+    {
+        OutError = TEXT("Edges must be Exec, Data or Both and Direction must be Upstream, Downstream or Both");
+        return false;
+    }
+
+    const FString NodeGuid = GeoBlueprintJsonExportServer::GetOptionalString(*Request.Object, TEXT("Node"));
+    FGuid Guid;
+    UEdGraphNode* Node = FGuid::Parse(NodeGuid, Guid) ? FGeoBlueprintJsonGraphExporter::FindNodeByGuid(Blueprint, Guid) : nullptr;
+    if (!Node)
+    {
+        OutError = FString::Printf(TEXT("'%s' has no node '%s'"), *AssetPath.ToString(), *NodeGuid);
+        return false;
+    }
+
+    FGeoJsonArena Arena;
+    FGeoBlueprintJsonGraphExporter Exporter(Arena);
+    Exporter.SetHeatDataEnabled(false);
+    const int32 MaxHops = GeoBlueprintJsonExportServer::GetOptionalInt(*Request.Object, TEXT("Hops"), 2);
+    Exporter.BuildNeighborhoodObject(Node, MaxHops, EdgeFilter, Direction)->SerializeUtf8(OutResult, false);
+    return true;
+}
+
+bool FGeoBlueprintJsonExportServer::ExportCatalog(TArray<uint8>& OutResult, FString& OutError)
+{
+    const FString Catalog = UGeoBlueprintJsonGraphFunctionLibrary::ExportAllAvailableNodesAsJson();
+    if (Catalog.IsEmpty())
+    {
+        OutError = TEXT("The node catalog is empty");
+        return false;
+    }
+    GeoBlueprintJsonExportServer::CondenseJson(Catalog, OutResult);
+    return true;
+}
+
+bool FGeoBlueprintJsonExportServer::ExportPropertySnapshot(const FRequest& Request, TArray<uint8>& OutResult, FName& OutPackageName, bool& bOutCacheable, FString& OutError)
+{
+    const FSoftObjectPath ObjectPath = GeoBlueprintJsonExportServer::MakeObjectPath(GeoBlueprintJsonExportServer::GetOptionalString(*Request.Object, TEXT("Object")));
+    UObject* Object = ObjectPath.ResolveObject();
+    if (!Object)
+    {
+        Object = ObjectPath.TryLoad();
+    }
+    if (!Object)
+    {
+        OutError = FString::Printf(TEXT("Could not find or load '%s'"), *ObjectPath.ToString());
+        return false;
+    }
+
+    UPackage* Package = Object->GetPackage();
+    OutPackageName = Package->GetFName();
+
+    // Objects living in a world change every frame without being modified, so they are never cached
+    bOutCacheable = !Package->HasAnyPackageFlags(PKG_PlayInEditor) && !Object->GetTypedOuter<UWorld>();
+
+    GeoBlueprintJsonExportServer::CondenseJson(UGeoBlueprintJsonFunctionLibrary::ConvertBlueprintToJson(Object), OutResult);
+    return true;
+}
+
+TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> FGeoBlueprintJsonExportServer::FindCached(const FString& Key)
+{
+    FScopeLock Lock(&CacheLock);
+    const FCacheEntry* Entry = Cache.Find(Key);
+    return Entry ? Entry->Bytes : nullptr;
+}
+
+void FGeoBlueprintJsonExportServer::AddCached(const FString& Key, TArray<FName>&& PackageNames, TArray<uint8>&& Bytes)
+{
+    FScopeLock Lock(&CacheLock);
+
+    RemoveCached(Key);
+
+    // Evicts arbitrary entries; anything evicted is simply converted again on its next request
+    const int64 EntryBytes = Bytes.Num();
+    while (Cache.Num() > 0 && CacheBytes + EntryBytes > GeoBlueprintJsonExportServer::MaxCacheBytes)
+    {
+        const FString EvictedKey = Cache.CreateConstIterator()->Key;
+        RemoveCached(EvictedKey);
+    }
+
+    FCacheEntry& Entry = Cache.Add(Key);
+    Entry.Bytes = MakeShared<const TArray<uint8>, ESPMode::ThreadSafe>(MoveTemp(Bytes));
+    Entry.PackageNames = MoveTemp(PackageNames);
+    for (const FName PackageName : Entry.PackageNames)
+    {
+        KeysByPackage.Add(PackageName, Key);
+    }
+    CacheBytes += EntryBytes;
+}
+
+void FGeoBlueprintJsonExportServer::RemoveCached(const FString& Key)
+{
+    // Called with CacheLock held
+    FCacheEntry Entry;
+    if (Cache.RemoveAndCopyValue(Key, Entry))
+    {
+        CacheBytes -= Entry.Bytes->Num();
+        for (const FName PackageName : Entry.PackageNames)
+        {
+            KeysByPackage.RemoveSingle(PackageName, Key);
+        }
+    }
+}
+
+void FGeoBlueprintJsonExportServer::InvalidatePackage(FName PackageName)
+{
+    FScopeLock Lock(&CacheLock);
+
+    TArray<FString> Keys;
+    KeysByPackage.MultiFind(PackageName, Keys);
+    for (const FString& Key : Keys)
+    {
+        RemoveCached(Key);
+    }
+}
+
+void FGeoBlueprintJsonExportServer::InvalidateAll()
+{
+    FScopeLock Lock(&CacheLock);
+    Cache.Empty();
+    KeysByPackage.Empty();
+    CacheBytes = 0;
+}
+
+TArray<uint8> FGeoBlueprintJsonExportServer::MakeResponse(const TSharedPtr<FJsonValue>& Id, const TArray<uint8>* Result, bool bCached, const FString& Error)
+{
+    FGeoJsonArena Arena(1024);
+    FGeoJsonObject Envelope(Arena);
+    if (Id.IsValid() && Id->Type == EJson::Number)
+    {
+        Envelope.SetNumberField(TEXT("Id"), Id->AsNumber());
+    }
+    else if (Id.IsValid() && Id->Type == EJson::String)
+    {
+        Envelope.SetStringField(TEXT("Id"), Id->AsString());
+    }
+    else
+    {
+        Envelope.SetNullField(TEXT("Id"));
+    }
+    Envelope.SetBoolField(TEXT("Ok"), Result != nullptr);
+    if (Result)
+    {
+        Envelope.SetBoolField(TEXT("Cached"), bCached);
+    }
+    else
+    {
+        Envelope.SetStringField(TEXT("Error"), Error);
+    }
+
+    TArray<uint8> Bytes;
+    Envelope.SerializeUtf8(Bytes, false);
+
+    // The result is already encoded, so it is spliced in rather than parsed back into the envelope
+    if (Result)
+    {
+        Bytes.Pop(EAllowShrinking::No);
+        GeoBlueprintJsonExportServer::AppendUtf8(Bytes, ",\"Result\":");
+        Bytes.Append(*Result);
+        Bytes.Add('}');
+    }
+    Bytes.Add('\n');
+    return Bytes;
+}
+
+void FGeoBlueprintJsonExportServer::OnObjectModified(UObject* Object)
+{
+    if (Object && !Object->HasAnyFlags(RF_Transient))
+    {
+        InvalidatePackage(Object->GetPackage()->GetFName());
+    }
+}
+
+void FGeoBlueprintJsonExportServer::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+    OnObjectModified(Object);
+}
+
+void FGeoBlueprintJsonExportServer::OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext)
+{
+    if (Package)
+    {
+        InvalidatePackage(Package->GetFName());
+    }
+}
+
+void FGeoBlueprintJsonExportServer::OnBlueprintPreCompile(UBlueprint* Blueprint)
+{
+    if (Blueprint)
+    {
+        InvalidatePackage(Blueprint->GetPackage()->GetFName());
+    }
+
+    // The catalog lists Blueprint functions and macros as well
+    InvalidatePackage(NAME_None);
+}
+
+void FGeoBlueprintJsonExportServer::OnAssetRemoved(const FAssetData& AssetData)
+{
+    InvalidatePackage(AssetData.PackageName);
+}
+
+void FGeoBlueprintJsonExportServer::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    InvalidatePackage(AssetData.PackageName);
+    InvalidatePackage(FSoftObjectPath(OldObjectPath).GetLongPackageFName());
+}
+
+void FGeoBlueprintJsonExportServer::OnModulesChanged(FName ModuleName, EModuleChangeReason Reason)
+{
+    InvalidatePackage(NAME_None);
+}
+
+void FGeoBlueprintJsonExportServer::OnPackageReloaded(EPackageReloadPhase Phase, FPackageReloadedEvent* Event)
+{
+    if (Phase == EPackageReloadPhase::PostBatchPostGC)
+    {
+        InvalidateAll();
+    }
+}
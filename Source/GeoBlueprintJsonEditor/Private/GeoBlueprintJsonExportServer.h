@@ -0,0 +1,149 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonValue.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/ObjectSaveContext.h"
+#include <atomic>
+
+class FJsonObject;
+class FSocket;
+class UBlueprint;
+class UPackage;
+struct FAssetData;
+struct FPropertyChangedEvent;
+class FPackageReloadedEvent;
+enum class EPackageReloadPhase : uint8;
+
+/**
+ * Opt-in export server for external tools, so they can ask a running editor for exports instead of
+ * booting one per request. Listens on 127.0.0.1 only. Each request is one JSON object per line, and
+ * each response is one condensed JSON object per line:
+ *
+ *     {"Id": 1, "Type": "ExportGraph", "Asset": "/Game/BP_Door.BP_Door"}
+ *     {"Id": 1, "Ok": true, "Cached": false, "Result": { ... }}
+ *
+ * Types are ExportGraph (Asset, optional Graph), ExportNeighborhood (Asset, Node, optional Hops, Edges
+ * and Direction), Catalog, PropertySnapshot (Object), Stats, Ping and Shutdown. Set "NoCache": true
+ * to bypass the cache. A cache hit can overtake an earlier miss, so clients match responses to
+ * requests by Id.
+ *
+ * One server thread owns every socket and answers cache hits itself. Misses are converted on the game
+ * thread from a ticker and their results are kept until the package they came from, or a package it
+ * references directly, is modified, saved, compiled, renamed, deleted or reloaded. Graph exports carry
+ * no heat data, since a capture changes without touching any package.
+ */
+class FGeoBlueprintJsonExportServer
+{
+public:
+    static constexpr int32 DefaultPort = 27480;
+
+    static FGeoBlueprintJsonExportServer& Get();
+
+    bool Start(int32 InPort = DefaultPort);
+    void Stop();
+    bool IsRunning() const { return bRunning; }
+    int32 GetPort() const { return Port; }
+
+    /** Drops every cached result converted from the package or from one referencing it */
+    void InvalidatePackage(FName PackageName);
+    void InvalidateAll();
+
+private:
+    struct FClient
+    {
+        int32 Id = 0;
+        FSocket* Socket = nullptr;
+        TArray<uint8> Inbox;
+        TArray<uint8> Outbox;
+        int32 OutboxOffset = 0;
+        bool bDisconnected = false;
+    };
+
+    struct FRequest
+    {
+        int32 ClientId = 0;
+        FString Type;
+        FString Key;
+        bool bNoCache = false;
+        TSharedPtr<FJsonValue> Id;
+        TSharedPtr<FJsonObject> Object;
+    };
+
+    struct FResponse
+    {
+        int32 ClientId = 0;
+        TArray<uint8> Bytes;
+    };
+
+    struct FCacheEntry
+    {
+        TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> Bytes;
+        TArray<FName> PackageNames;
+    };
+
+    // Server thread
+    void RunServer();
+    void AcceptClients(TArray<TUniquePtr<FClient>>& Clients);
+    bool ReadClient(FClient& Client, TArray<uint8>& ReadBuffer);
+    bool WriteClient(FClient& Client);
+    void HandleRequestLine(FClient& Client, const FString& Line);
+
+    // Game thread
+    bool Tick(float DeltaTime);
+    void ProcessRequest(const FRequest& Request);
+    bool ExportGraph(const FRequest& Request, TArray<uint8>& OutResult, FName& OutPackageName, FString& OutError);
+    bool ExportNeighborhood(const FRequest& Request, TArray<uint8>& OutResult, FName& OutPackageName, FString& OutError);
+    bool ExportCatalog(TArray<uint8>& OutResult, FString& OutError);
+    bool ExportPropertySnapshot(const FRequest& Request, TArray<uint8>& OutResult, FName& OutPackageName, bool& bOutCacheable, FString& OutError);
+
+    // Cache, shared by both threads
+    TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> FindCached(const FString& Key);
+    void AddCached(const FString& Key, TArray<FName>&& PackageNames, TArray<uint8>&& Bytes);
+    void RemoveCached(const FString& Key);
+
+    static TArray<uint8> MakeResponse(const TSharedPtr<FJsonValue>& Id, const TArray<uint8>* Result, bool bCached, const FString& Error);
+
+    // Invalidation, game thread
+    void OnObjectModified(UObject* Object);
+    void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+    void OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext);
+    void OnBlueprintPreCompile(UBlueprint* Blueprint);
+    void OnAssetRemoved(const FAssetData& AssetData);
+    void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+    void OnModulesChanged(FName ModuleName, EModuleChangeReason Reason);
+    void OnPackageReloaded(EPackageReloadPhase Phase, FPackageReloadedEvent* Event);
+    void RegisterCompileHandler();
+
+    int32 Port = DefaultPort;
+    FSocket* ListenSocket = nullptr;
+    TFuture<void> ServerThread;
+    std::atomic<bool> bRunning = false;
+    std::atomic<bool> bStopRequested = false;
+    int32 NextClientId = 1;
+    std::atomic<int32> NumClients = 0;
+
+    TQueue<FRequest, EQueueMode::Spsc> Requests;
+    TQueue<FResponse, EQueueMode::Spsc> Responses;
+    FTSTicker::FDelegateHandle TickerHandle;
+
+    FCriticalSection CacheLock;
+    TMap<FString, FCacheEntry> Cache;
+    TMultiMap<FName, FString> KeysByPackage;
+    int64 CacheBytes = 0;
+    std::atomic<int64> CacheHits = 0;
+    std::atomic<int64> CacheMisses = 0;
+
+    FDelegateHandle ObjectModifiedHandle;
+    FDelegateHandle PropertyChangedHandle;
+    FDelegateHandle PackageSavedHandle;
+    FDelegateHandle PostEngineInitHandle;
+    FDelegateHandle BlueprintPreCompileHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+    FDelegateHandle ModulesChangedHandle;
+    FDelegateHandle PackageReloadedHandle;
+};
@@ -0,0 +1,1229 @@
+#include "GeoBlueprintJsonGraphExporter.h"
+#include "GeoBlueprintJsonAnimAnalysis.h"
+#include "GeoBlueprintJsonCompileProfiler.h"
+#include "GeoBlueprintJsonComponentAnalysis.h"
+#include "GeoBlueprintJsonDom.h"
+#include "GeoBlueprintJsonFunctionLibrary.h"
+#include "GeoBlueprintJsonGraphMetrics.h"
+#include "GeoBlueprintJsonInheritanceCache.h"
+#include "GeoBlueprintJsonNodeGuidIndex.h"
+#include "GeoBlueprintJsonNodeTitleCache.h"
+#include "GeoBlueprintJsonPureNodeAnalysis.h"
+#include "GeoBlueprintJsonReferenceAnalysis.h"
+#include "GeoBlueprintJsonReplicationAnalysis.h"
+#include "GeoBlueprintJsonScriptProfiler.h"
+#include "GeoBlueprintJsonWidgetAnalysis.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Variable.h"
+#include "K2Node_Event.h"
+#include "K2Node_CustomEvent.h"
+#include "K2Node_IfThenElse.h"
+#include "K2Node_ExecutionSequence.h"
+#include "K2Node_Select.h"
+#include "K2Node_DynamicCast.h"
+#include "K2Node_MacroInstance.h"
+#include "K2Node_Timeline.h"
+#include "K2Node_SpawnActor.h"
+#include "K2Node_VariableGet.h"
+#include "K2Node_VariableSet.h"
+#include "K2Node_Knot.h"
+#include "K2Node_Switch.h"
+#include "K2Node_CommutativeAssociativeBinaryOperator.h"
+#include "K2Node_MakeArray.h"
+#include "K2Node_MakeStruct.h"
+#include "K2Node_BreakStruct.h"
+#include "K2Node_CallParentFunction.h"
+#include "AnimGraphNode_Base.h"
+#include "Animation/AnimBlueprint.h"
+#include "Components/Widget.h"
+#include "Engine/Blueprint.h"
+#include "WidgetBlueprint.h"
+
+namespace GeoBlueprintJsonGraphExporter
+{
+    static bool IsFollowed(const UEdGraphPin* Pin, EGeoBlueprintJsonEdgeFilter EdgeFilter, EGeoBlueprintJsonEdgeDirection Direction)
+    {
+        const bool bExec = Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+        const bool bKindFollowed = EdgeFilter == EGeoBlueprintJsonEdgeFilter::Both || (EdgeFilter == EGeoBlueprintJsonEdgeFilter::Exec) == bExec;
+        const bool bDirectionFollowed = Direction == EGeoBlueprintJsonEdgeDirection::Both || (Direction == EGeoBlueprintJsonEdgeDirection::Downstream) == (Pin->Direction == EGPD_Output);
+        return bKindFollowed && bDirectionFollowed;
+    }
+}
+
+FGeoBlueprintJsonGraphExporter::FGeoBlueprintJsonGraphExporter(FGeoJsonArena& InArena, const FGeoBlueprintJsonGraphExportOptions& InOptions)
+    : Arena(InArena)
+    , Options(InOptions)
+    , ContentHasher(InOptions.bIncludeLayoutInContentHashes)
+{
+}
+
+FGeoJsonObject* FGeoBlueprintJsonGraphExporter::BuildBlueprintObject(UBlueprint* Blueprint)
+{
+    FGeoJsonObject* BlueprintObject = BuildBlueprintHeaderObject(Blueprint);
+    if (!BlueprintObject)
+    {
+        return nullptr;
+    }
+
+    AddGraphArray(*BlueprintObject, TEXT("EventGraphs"), Blueprint->UbergraphPages, TEXT("EventGraph"));
+    AddGraphArray(*BlueprintObject, TEXT("FunctionGraphs"), Blueprint->FunctionGraphs, TEXT("FunctionGraph"));
+    AddGraphArray(*BlueprintObject, TEXT("MacroGraphs"), Blueprint->MacroGraphs, TEXT("MacroGraph"));
+    AddGraphArray(*BlueprintObject, TEXT("DelegateGraphs"), Blueprint->DelegateSignatureGraphs, TEXT("DelegateGraph"));
+
+    // State machines, states and transitions belong to anim graph nodes rather than to the Blueprint
+    if (Blueprint->IsA<UAnimBlueprint>())
+    {
+        FGeoJsonArray* AnimGraphsArray = BlueprintObject->SetArrayField(TEXT("AnimGraphs"));
+        FGeoBlueprintJsonAnimAnalysis::ForEachNestedGraph(Blueprint, [this, AnimGraphsArray](UEdGraph* Graph, const TCHAR* GraphType)
+        {
+            if (FGeoJsonObject* GraphObject = BuildGraphObject(Graph, GraphType))
+            {
+                AnimGraphsArray->AddObject(GraphObject);
+            }
+        });
+    }
+
+    AddBlueprintContentHash(*BlueprintObject, Blueprint);
+    return BlueprintObject;
+}
+
+FGeoJsonObject* FGeoBlueprintJsonGraphExporter::BuildBlueprintHeaderObject(UBlueprint* Blueprint)
+{
+    FGeoJsonObject* BlueprintObject = BeginBlueprintHeaderObject(Blueprint);
+    if (!BlueprintObject)
+    {
+        return nullptr;
+    }
+
+    for (int32 Analysis = 0; Analysis < static_cast<int32>(EHeaderAnalysis::Num); ++Analysis)
+    {
+        AddHeaderAnalysis(*BlueprintObject, Blueprint, static_cast<EHeaderAnalysis>(Analysis));
+    }
+    return BlueprintObject;
+}
+
+FGeoJsonObject* FGeoBlueprintJsonGraphExporter::BeginBlueprintHeaderObject(UBlueprint* Blueprint)
+{
+    if (!Blueprint)
+    {
+        return nullptr;
+    }
+
+    FGeoJsonObject* BlueprintObject = Arena.New<FGeoJsonObject>(Arena);
+
+    // Add basic Blueprint information
+    BlueprintObject->SetStringField(TEXT("BlueprintName"), Blueprint->GetName());
+    BlueprintObject->SetStringField(TEXT("BlueprintClass"), Blueprint->GetClass()->GetName());
+    BlueprintObject->SetStringField(TEXT("ParentClass"), Blueprint->ParentClass ? Blueprint->ParentClass->GetName() : TEXT("None"));
+
+    // Written with Components, since GetBlueprintSemanticTags reads the two together
+    if (Options.bIncludeComponents || InheritanceCache)
+    {
+        FGeoJsonArray* InterfacesArray = BlueprintObject->SetArrayField(TEXT("Interfaces"));
+        for (const FBPInterfaceDescription& Interface : Blueprint->ImplementedInterfaces)
+        {
+            if (Interface.Interface)
+            {
+                InterfacesArray->AddString(Interface.Interface->GetName());
+            }
+        }
+    }
+
+    return BlueprintObject;
+}
+
+void FGeoBlueprintJsonGraphExporter::AddHeaderAnalysis(FGeoJsonObject& BlueprintObject, UBlueprint* Blueprint, EHeaderAnalysis Analysis)
+{
+    switch (Analysis)
+    {
+    case EHeaderAnalysis::Animation:
+        if (Options.bIncludeAnimAnalysis && Blueprint->IsA<UAnimBlueprint>())
+        {
+            BlueprintObject.SetObjectField(TEXT("Animation"), BuildAnimReportObject(FGeoBlueprintJsonAnimAnalysis::AnalyzeBlueprint(Blueprint)));
+        }
+        break;
+
+    case EHeaderAnalysis::WidgetTree:
+        if (Options.bIncludeWidgetTree && Blueprint->IsA<UWidgetBlueprint>())
+        {
+            AddWidgetFields(BlueprintObject, FGeoBlueprintJsonWidgetAnalysis::AnalyzeBlueprint(Blueprint));
+        }
+        break;
+
+    case EHeaderAnalysis::Replication:
+        if (Options.bIncludeReplication)
+        {
+            const FGeoBlueprintJsonReplicationReport Report = FGeoBlueprintJsonReplicationAnalysis::AnalyzeBlueprint(Blueprint);
+            if (Report.bIsReplicable)
+            {
+                BlueprintObject.SetObjectField(TEXT("Replication"), BuildReplicationObject(Report));
+            }
+        }
+        break;
+
+    case EHeaderAnalysis::HardReferences:
+        if (Options.bIncludeHardReferences)
+        {
+            AddReferenceFields(BlueprintObject, FGeoBlueprintJsonReferenceAnalysis::AnalyzeBlueprint(Blueprint));
+        }
+        break;
+
+    case EHeaderAnalysis::Components:
+        if (InheritanceCache)
+        {
+            AddInheritanceFields(BlueprintObject, Blueprint);
+        }
+        else if (Options.bIncludeComponents)
+        {
+            AddComponentFields(BlueprintObject, FGeoBlueprintJsonComponentAnalysis::AnalyzeBlueprint(Blueprint));
+        }
+        break;
+
+    case EHeaderAnalysis::Num:
+        break;
+    }
+}
+
+void FGeoBlueprintJsonGraphExporter::AddBlueprintContentHash(FGeoJsonObject& BlueprintObject, UBlueprint* Blueprint)
+{
+    // The hasher keeps every graph hash it built, so after the graph exports this only combines them
+    if (Options.bIncludeContentHashes)
+    {
+        BlueprintObject.SetStringField(TEXT("ContentHash"), FGeoBlueprintJsonContentHasher::ToString(ContentHasher.HashBlueprint(Blueprint)));
+    }
+}
+
+void FGeoBlueprintJsonGraphExporter::AddInheritanceFields(FGeoJsonObject& BlueprintObject, UBlueprint* Blueprint)
+{
+    const FGeoBlueprintJsonInheritanceCache::FEntry* Parent = InheritanceCache->FindParent(Blueprint);
+    FGeoBlueprintJsonInheritanceCache::FEntry Entry;
+    Entry.AssetPath = Blueprint->GetPathName();
+    if (Parent)
+    {
+        BlueprintObject.SetStringField(TEXT("ParentBlueprint"), Parent->AssetPath);
+    }
+
+    // The class default object's archetype is the parent's, so this is exactly what the Blueprint changes
+    if (UObject* Defaults = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr)
+    {
+        UGeoBlueprintJsonFunctionLibrary::WriteBlueprintJsonDelta(Defaults, nullptr, *BlueprintObject.SetObjectField(TEXT("Defaults")));
+    }
+
+    if (Options.bIncludeComponents)
+    {
+        FGeoBlueprintJsonActorCost ActorCost = Parent
+            ? FGeoBlueprintJsonComponentAnalysis::AnalyzeBlueprintOverrides(Blueprint)
+            : FGeoBlueprintJsonComponentAnalysis::AnalyzeBlueprint(Blueprint);
+
+        if (Parent)
+        {
+            Entry.ComponentCosts = Parent->ComponentCosts;
+        }
+        for (const FGeoBlueprintJsonComponentCost& Cost : ActorCost.Components)
+        {
+            Entry.ComponentCosts.Add(Cost.Name, Cost.EstimatedCost);
+        }
+
+        // The instance cost still covers the inherited components the record leaves out
+        ActorCost.EstimatedCost = ActorCost.bActorTickEnabled ? FGeoBlueprintJsonComponentAnalysis::GetTickCost(ActorCost.ActorTickInterval) : 0.0;
+        for (const TPair<FName, double>& ComponentCost : Entry.ComponentCosts)
+        {
+            ActorCost.EstimatedCost += ComponentCost.Value;
+        }
+        AddComponentFields(BlueprintObject, ActorCost);
+    }
+
+    InheritanceCache->Add(Blueprint, MoveTemp(Entry));
+}
+
+void FGeoBlueprintJsonGraphExporter::AddComponentFields(FGeoJsonObject& Object, const FGeoBlueprintJsonActorCost& ActorCost)
+{
+    if (!ActorCost.bIsActor)
+    {
+        return;
+    }
+
+    Object.SetBoolField(TEXT("ActorTickEnabled"), ActorCost.bActorTickEnabled);
+    Object.SetNumberField(TEXT("ActorTickInterval"), ActorCost.ActorTickInterval);
+    Object.SetNumberField(TEXT("EstimatedInstanceCost"), ActorCost.EstimatedCost);
+
+    FGeoJsonArray* ComponentsArray = Object.SetArrayField(TEXT("Components"));
+    for (const FGeoBlueprintJsonComponentCost& Cost : ActorCost.Components)
+    {
+        ComponentsArray->AddObject(BuildComponentObject(Cost));
+    }
+}
+
+FGeoJsonObject* FGeoBlueprintJsonGraphExporter::BuildComponentObject(const FGeoBlueprintJsonComponentCost& Cost)
+{
+    FGeoJsonObject* ComponentObject = Arena.New<FGeoJsonObject>(Arena);
+    ComponentObject->SetStringField(TEXT("Name"), Cost.Name.ToString());
+    ComponentObject->SetStringField(TEXT("Class"), Cost.Template ? Cost.Template->GetClass()->GetName() : TEXT("None"));
+    ComponentObject->SetStringField(TEXT("Parent"), Cost.ParentName.ToString());
+    if (!Cost.AttachSocketName.IsNone())
+    {
+        ComponentObject->SetStringField(TEXT("AttachSocket"), Cost.AttachSocketName.ToString());
+    }
+    ComponentObject->SetStringField(TEXT("Source"), Cost.Source);
+    ComponentObject->SetBoolField(TEXT("TickEnabled"), Cost.bTickEnabled);
+    ComponentObject->SetNumberField(TEXT("TickInterval"), Cost.TickInterval);
+    ComponentObject->SetBoolField(TEXT("GenerateOverlapEvents"), Cost.bGenerateOverlapEvents);
+    ComponentObject->SetStringField(TEXT("Collision"), StaticEnum<ECollisionEnabled::Type>()->GetNameStringByValue(Cost.CollisionEnabled));
+    ComponentObject->SetStringField(TEXT("CollisionProfile"), Cost.CollisionProfileName.ToString());
+    ComponentObject->SetBoolField(TEXT("SimulatePhysics"), Cost.bSimulatePhysics);
+    ComponentObject->SetBoolField(TEXT("HitEvents"), Cost.bHitEvents);
+    ComponentObject->SetBoolField(TEXT("CastShadow"), Cost.bCastShadow);
+    ComponentObject->SetNumberField(TEXT("EstimatedCost"), Cost.EstimatedCost);
+    return ComponentObject;
+}
+
+void FGeoBlueprintJsonGraphExporter::AddWidgetFields(FGeoJsonObject& Object, const FGeoBlueprintJsonWidgetBlueprintReport& Report)
+{
+    if (!Report.bIsWidgetBlueprint)
+    {
+        return;
+    }
+
+    FGeoJsonArray* WidgetsArray = Object.SetArrayField(TEXT("WidgetTree"));
+    for (const FGeoBlueprintJsonWidgetInfo& Info : Report.Widgets)
+    {
+        FGeoJsonObject* WidgetObject = WidgetsArray->AddObject();
+        WidgetObject->SetStringField(TEXT("Name"), Info.Name.ToString());
+        WidgetObject->SetStringField(TEXT("Class"), Info.Widget ? Info.Widget->GetClass()->GetName() : TEXT("None"));
+        WidgetObject->SetStringField(TEXT("Parent"), Info.ParentName.ToString());
+        WidgetObject->SetNumberField(TEXT("Depth"), Info.Depth);
+        WidgetObject->SetBoolField(TEXT("IsVariable"), Info.bIsVariable);
+        WidgetObject->SetBoolField(TEXT("IsVolatile"), Info.bIsVolatile);
+        WidgetObject->SetStringField(TEXT("Visibility"), StaticEnum<ESlateVisibility>()->GetNameStringByValue(static_cast<int64>(Info.Visibility)));
+        WidgetObject->SetNumberField(TEXT("Bindings"), Info.NumBindings);
+    }
+
+    FGeoJsonArray* BindingsArray = Object.SetArrayField(TEXT("Bindings"));
+    for (const FGeoBlueprintJsonBindingCost& Cost : Report.Bindings)
+    {
+        AddBindingFields(*BindingsArray->AddObject(), Cost);
+    }
+    Object.SetNumberField(TEXT("EstimatedBindingCost"), Report.EstimatedBindingCost);
+}
+
+void FGeoBlueprintJsonGraphExporter::AddBindingFields(FGeoJsonObject& Object, const FGeoBlueprintJsonBindingCost& Cost)
+{
+    Object.SetStringField(TEXT("Widget"), Cost.WidgetName);
+    Object.SetStringField(TEXT("Property"), Cost.PropertyName.ToString());
+    Object.SetStringField(TEXT("Kind"), Cost.bIsFunction ? TEXT("Function") : TEXT("Property"));
+    if (Cost.bIsFunction)
+    {
+        Object.SetStringField(TEXT("Function"), Cost.FunctionName.ToString());
+    }
+    if (!Cost.SourcePath.IsEmpty())
+    {
+        Object.SetStringField(TEXT("SourcePath"), Cost.SourcePath);
+    }
+    Object.SetNumberField(TEXT("Nodes"), Cost.NumNodes);
+    Object.SetNumberField(TEXT("Calls"), Cost.NumCalls);
+    Object.SetNumberField(TEXT("Casts"), Cost.NumCasts);
+    Object.SetNumberField(TEXT("Loops"), Cost.NumLoops);
+    Object.SetNumberField(TEXT("EstimatedCost"), Cost.EstimatedCost);
+}
+
+FGeoJsonObject* FGeoBlueprintJsonGraphExporter::BuildReplicationObject(const FGeoBlueprintJsonReplicationReport& Report)
+{
+    FGeoJsonObject* ReplicationObject = Arena.New<FGeoJsonObject>(Arena);
+    ReplicationObject->SetBoolField(TEXT("Replicates"), Report.bReplicates);
+    if (Report.bIsActor)
+    {
+        ReplicationObject->SetBoolField(TEXT("ReplicateMovement"), Report.bReplicateMovement);
+        ReplicationObject->SetNumberField(TEXT("NetUpdateFrequency"), Report.NetUpdateFrequency);
+        ReplicationObject->SetNumberField(TEXT("MinNetUpdateFrequency"), Report.MinNetUpdateFrequency);
+        ReplicationObject->SetNumberField(TEXT("NetPriority"), Report.NetPriority);
+        ReplicationObject->SetNumberField(TEXT("NetCullDistance"), Report.NetCullDistance);
+        ReplicationObject->SetStringField(TEXT("NetDormancy"), StaticEnum<ENetDormancy>()->GetNameStringByValue(Report.NetDormancy));
+        ReplicationObject->SetBoolField(TEXT("AlwaysRelevant"), Report.bAlwaysRelevant);
+        ReplicationObject->SetBoolField(TEXT("OnlyRelevantToOwner"), Report.bOnlyRelevantToOwner);
+        ReplicationObject->SetBoolField(TEXT("NetUseOwnerRelevancy"), Report.bNetUseOwnerRelevancy);
+    }
+    ReplicationObject->SetNumberField(TEXT("BlueprintProperties"), Report.NumBlueprintProperties);
+    ReplicationObject->SetNumberField(TEXT("EstimatedBytesPerUpdate"), Report.EstimatedBytesPerUpdate);
+    ReplicationObject->SetNumberField(TEXT("EstimatedBytesPerSecond"), Report.EstimatedBytesPerSecond);
+
+    FGeoJsonArray* PropertiesArray = ReplicationObject->SetArrayField(TEXT("Properties"));
+    for (const FGeoBlueprintJsonReplicatedProperty& Property : Report.Properties)
+    {
+        FGeoJsonObject* PropertyObject = PropertiesArray->AddObject();
+        PropertyObject->SetStringField(TEXT("Name"), Property.Name.ToString());
+        PropertyObject->SetStringField(TEXT("Owner"), Property.OwnerClassName.ToString());
+        PropertyObject->SetBoolField(TEXT("DeclaredInBlueprint"), Property.bDeclaredInBlueprint);
+        PropertyObject->SetStringField(TEXT("Condition"), StaticEnum<ELifetimeCondition>()->GetNameStringByValue(Property.Condition));
+        if (!Property.RepNotifyFunc.IsNone())
+        {
+            PropertyObject->SetStringField(TEXT("RepNotify"), Property.RepNotifyFunc.ToString());
+        }
+        PropertyObject->SetNumberField(TEXT("EstimatedBytes"), Property.EstimatedBytes);
+        PropertyObject->SetBoolField(TEXT("SentPerUpdate"), Property.bSentPerUpdate);
+    }
+    return ReplicationObject;
+}
+
+void FGeoBlueprintJsonGraphExporter::AddReferenceFields(FGeoJsonObject& Object, const FGeoBlueprintJsonReferenceReport& Report)
+{
+    FGeoJsonArray* ReferencesArray = Object.SetArrayField(TEXT("HardReferences"));
+    for (const FGeoBlueprintJsonHardReference& Reference : Report.References)
+    {
+        FGeoJsonObject* ReferenceObject = ReferencesArray->AddObject();
+        ReferenceObject->SetStringField(TEXT("Kind"), Reference.Kind);
+        ReferenceObject->SetStringField(TEXT("Target"), Reference.TargetPath);
+        ReferenceObject->SetStringField(TEXT("TargetPackage"), Reference.TargetPackage.ToString());
+        if (Reference.Node)
+        {
+            ReferenceObject->SetStringField(TEXT("NodeGuid"), Reference.Node->NodeGuid.ToString());
+            ReferenceObject->SetStringField(TEXT("NodeName"), FGeoBlueprintJsonNodeTitleCache::Get().GetTitle(Reference.Node));
+            ReferenceObject->SetStringField(TEXT("Graph"), GetGraphPath(Reference.Node->GetGraph()));
+        }
+        else
+        {
+            ReferenceObject->SetStringField(TEXT("Variable"), Reference.VariableName.ToString());
+        }
+        ReferenceObject->SetNumberField(TEXT("ClosurePackages"), Reference.Closure.NumPackages);
+        ReferenceObject->SetNumberField(TEXT("ClosureDiskBytes"), static_cast<double>(Reference.Closure.DiskBytes));
+    }
+
+    FGeoJsonObject* ClosureObject = Object.SetObjectField(TEXT("LoadClosure"));
+    ClosureObject->SetNumberField(TEXT("Packages"), Report.Closure.NumPackages);
+    ClosureObject->SetNumberField(TEXT("DiskBytes"), static_cast<double>(Report.Closure.DiskBytes));
+}
+
+void FGeoBlueprintJsonGraphExporter::AddCompileProfileFields(FGeoJsonObject& Object, const FGeoBlueprintJsonCompileProfile& Profile)
+{
+    auto AddCompileTimes = [](FGeoJsonObject& ProfileObject, const TCHAR* FieldName, const FGeoBlueprintJsonCompileTimes& Times)
+    {
+        FGeoJsonObject* TimesObject = ProfileObject.SetObjectField(FieldName);
+        TimesObject->SetNumberField(TEXT("FullCompileMs"), Times.FullCompileMs);
+        TimesObject->SetNumberField(TEXT("SkeletonRegenerationMs"), Times.SkeletonRegenerationMs);
+        TimesObject->SetNumberField(TEXT("BytecodeRecompileMs"), Times.BytecodeRecompileMs);
+    };
+
+    Object.SetBoolField(TEXT("Compiled"), Profile.bCompiled);
+    Object.SetNumberField(TEXT("Iterations"), Profile.Iterations);
+    AddCompileTimes(Object, TEXT("Median"), Profile.Median);
+    AddCompileTimes(Object, TEXT("Min"), Profile.Min);
+    Object.SetNumberField(TEXT("Functions"), Profile.NumFunctions);
+    Object.SetNumberField(TEXT("BytecodeBytes"), static_cast<double>(Profile.BytecodeBytes));
+    Object.SetNumberField(TEXT("Errors"), Profile.NumErrors);
+    Object.SetNumberField(TEXT("Warnings"), Profile.NumWarnings);
+
+    FGeoJsonArray* DependentsArray = Object.SetArrayField(TEXT("RecompiledDependents"));
+    for (const FString& Dependent : Profile.RecompiledDependents)
+    {
+        DependentsArray->AddString(Dependent);
+    }
+}
+
+const TCHAR* FGeoBlueprintJsonGraphExporter::GetGraphArrayName(const TCHAR* GraphType)
+{
+    static const TCHAR* const GraphArrayNames[][2] =
+    {
+        { TEXT("EventGraph"), TEXT("EventGraphs") },
+        { TEXT("FunctionGraph"), TEXT("FunctionGraphs") },
+        { TEXT("MacroGraph"), TEXT("MacroGraphs") },
+        { TEXT("DelegateGraph"), TEXT("DelegateGraphs") },
+    };
+    for (const TCHAR* const* Names : GraphArrayNames)
+    {
+        if (FCString::Strcmp(Names[0], GraphType) == 0)
+        {
+            return Names[1];
+        }
+    }
+
+    // Every other type is a graph nested in an anim graph node
+    return TEXT("AnimGraphs");
+}
+
+void FGeoBlueprintJsonGraphExporter::ForEachExportedGraph(UBlueprint* Blueprint, TFunctionRef<void(UEdGraph*, const TCHAR*)> Callback)
+{
+    auto VisitGraphs = [&Callback](const TArray<TObjectPtr<UEdGraph>>& Graphs, const TCHAR* GraphType)
+    {
+        for (UEdGraph* Graph : Graphs)
+        {
+            if (Graph)
+            {
+                Callback(Graph, GraphType);
+            }
+        }
+    };
+
+    // Same order as BuildBlueprintObject
+    VisitGraphs(Blueprint->UbergraphPages, TEXT("EventGraph"));
+    VisitGraphs(Blueprint->FunctionGraphs, TEXT("FunctionGraph"));
+    VisitGraphs(Blueprint->MacroGraphs, TEXT("MacroGraph"));
+    VisitGraphs(Blueprint->DelegateSignatureGraphs, TEXT("DelegateGraph"));
+    FGeoBlueprintJsonAnimAnalysis::ForEachNestedGraph(Blueprint, Callback);
+}
+
+FString FGeoBlueprintJsonGraphExporter::GetGraphPath(const UEdGraph* Graph)
+{
+    const UBlueprint* Blueprint = Graph ? Graph->GetTypedOuter<UBlueprint>() : nullptr;
+    return Blueprint ? Graph->GetPathName(Blueprint) : Graph ? Graph->GetName() : FString();
+}
+
+UEdGraphNode* FGeoBlueprintJsonGraphExporter::FindNodeByGuid(UBlueprint* Blueprint, const FGuid& NodeGuid)
+{
+    return FGeoBlueprintJsonNodeGuidIndex::Get().FindNode(Blueprint, NodeGuid);
+}
+
+FGeoJsonObject* FGeoBlueprintJsonGraphExporter::BuildAnimReportObject(const FGeoBlueprintJsonAnimBlueprintReport& Report)
+{
+    FGeoJsonObject* AnimObject = Arena.New<FGeoJsonObject>(Arena);
+    AnimObject->SetBoolField(TEXT("MultiThreadedUpdate"), Report.bUseMultiThreadedAnimationUpdate);
+    AnimObject->SetBoolField(TEXT("UsesUpdateAnimationEvent"), Report.bUsesUpdateAnimationEvent);
+    AnimObject->SetBoolField(TEXT("UsesThreadSafeUpdateAnimation"), Report.bUsesThreadSafeUpdateAnimation);
+    AnimObject->SetNumberField(TEXT("AnimNodes"), Report.Nodes.Num());
+    AnimObject->SetNumberField(TEXT("FastPathNodes"), Report.NumFastPathNodes);
+    AnimObject->SetNumberField(TEXT("SlowPathNodes"), Report.NumSlowPathNodes);
+    AnimObject->SetNumberField(TEXT("StateMachines"), Report.NumStateMachines);
+    AnimObject->SetNumberField(TEXT("States"), Report.NumStates);
+    AnimObject->SetNumberField(TEXT("Transitions"), Report.NumTransitions);
+    AnimObject->SetNumberField(TEXT("ThreadSafeFunctions"), Report.NumThreadSafeFunctions);
+    AnimObject->SetNumberField(TEXT("ThreadSafetyViolations"), Report.NumThreadSafetyViolations);
+
+    FGeoJsonArray* SlowNodesArray = AnimObject->SetArrayField(TEXT("SlowPathNodeList"));
+    for (const FGeoBlueprintJsonAnimNodeReport& NodeReport : Report.Nodes)
+    {
+        if (NodeReport.IsFastPath())
+        {
+            continue;
+        }
+
+        FGeoJsonObject* NodeObject = SlowNodesArray->AddObject();
+        NodeObject->SetStringField(TEXT("NodeGuid"), NodeReport.Node->NodeGuid.ToString());
+        NodeObject->SetStringField(TEXT("NodeName"), FGeoBlueprintJsonNodeTitleCache::Get().GetTitle(NodeReport.Node));
+        NodeObject->SetStringField(TEXT("Graph"), GetGraphPath(NodeReport.Node->GetGraph()));
+        FGeoJsonArray* PinsArray = NodeObject->SetArrayField(TEXT("SlowPathPins"));
+        for (const FName PinName : NodeReport.SlowPathPins)
+        {
+            PinsArray->AddString(PinName.ToString());
+        }
+    }
+
+    FGeoJsonArray* FunctionsArray = AnimObject->SetArrayField(TEXT("Functions"));
+    for (const FGeoBlueprintJsonAnimFunctionReport& FunctionReport : Report.Functions)
+    {
+        FGeoJsonObject* FunctionObject = FunctionsArray->AddObject();
+        FunctionObject->SetStringField(TEXT("Name"), FunctionReport.Graph->GetName());
+        FunctionObject->SetBoolField(TEXT("ThreadSafe"), FunctionReport.bThreadSafe);
+
+        // A function that only calls thread-safe functions could be marked thread-safe as it is
+        FunctionObject->SetBoolField(TEXT("CouldBeThreadSafe"), FunctionReport.UnsafeCalls.Num() == 0);
+        FGeoJsonArray* CallsArray = FunctionObject->SetArrayField(TEXT("UnsafeCalls"));
+        for (const FName CallName : FunctionReport.UnsafeCalls)
+        {
+            CallsArray->AddString(CallName.ToString());
+        }
+    }
+
+    return AnimObject;
+}
+
+void FGeoBlueprintJsonGraphExporter::AddGraphArray(FGeoJsonObject& BlueprintObject, const TCHAR* FieldName, const TArray<TObjectPtr<UEdGraph>>& Graphs, const TCHAR* GraphType)
+{
+    FGeoJsonArray* GraphsArray = BlueprintObject.SetArrayField(FieldName);
+    for (UEdGraph* Graph : Graphs)
+    {
+        if (FGeoJsonObject* GraphObject = BuildGraphObject(Graph, GraphType))
+        {
+            GraphsArray->AddObject(GraphObject);
+        }
+    }
+}
+
+FGeoJsonObject* FGeoBlueprintJsonGraphExporter::BuildGraphObject(UEdGraph* Graph, const TCHAR* GraphType)
+{
+    FGeoJsonArray* NodesArray = nullptr;
+    FGeoJsonObject* GraphObject = BeginGraphObject(Graph, GraphType, NodesArray);
+    if (!GraphObject)
+    {
+        return nullptr;
+    }
+
+    for (UEdGraphNode* Node : Graph->Nodes)
+    {
+        if (FGeoJsonObject* NodeObject = BuildNodeObject(Node))
+        {
+            NodesArray->AddObject(NodeObject);
+        }
+    }
+
+    FinishGraphObject(*GraphObject, Graph);
+    return GraphObject;
+}
+
+FGeoJsonObject* FGeoBlueprintJsonGraphExporter::BeginGraphObject(UEdGraph* Graph, const TCHAR* GraphType, FGeoJsonArray*& OutNodesArray)
+{
+    if (!Graph)
+    {
+        return nullptr;
+    }
+
+    FGeoJsonObject* GraphObject = Arena.New<FGeoJsonObject>(Arena);
+    GraphObject->SetStringField(TEXT("GraphName"), Graph->GetName());
+    GraphObject->SetStringField(TEXT("GraphType"), GraphType);
+    if (!Graph->GetOuter()->IsA<UBlueprint>())
+    {
+        GraphObject->SetStringField(TEXT("GraphPath"), GetGraphPath(Graph));
+    }
+
+    OutNodesArray = GraphObject->SetArrayField(TEXT("Nodes"));
+    return GraphObject;
+}
+
+void FGeoBlueprintJsonGraphExporter::FinishGraphObject(FGeoJsonObject& GraphObject, UEdGraph* Graph)
+{
+    AddGraphHeatFields(GraphObject, Graph);
+
+    // The node exports hashed every node already, so this only adds the links
+    if (Options.bIncludeContentHashes)
+    {
+        GraphObject.SetStringField(TEXT("ContentHash"), FGeoBlueprintJsonContentHasher::ToString(ContentHasher.HashGraph(Graph)));
+    }
+
+    if (Options.bIncludeGraphMetrics)
+    {
+        GraphObject.SetObjectField(TEXT("Metrics"), BuildGraphMetricsObject(FGeoBlueprintJsonGraphMetricsAnalysis::AnalyzeGraph(Graph)));
+    }
+
+    if (Options.bIncludePureNodeAnalysis)
+    {
+        const TArray<FGeoBlueprintJsonPureNodeCost> Costs = FGeoBlueprintJsonPureNodeAnalysis::AnalyzeGraph(Graph, Options.AssumedLoopIterations);
+
+        FGeoJsonArray* CostsArray = GraphObject.SetArrayField(TEXT("PureNodeEvaluations"));
+        for (int32 Index = 0; Index < Costs.Num() && Index < Options.MaxPureNodeResults; ++Index)
+        {
+            CostsArray->AddObject(BuildPureNodeCostObject(Costs[Index]));
+        }
+    }
+}
+
+FGeoJsonObject* FGeoBlueprintJsonGraphExporter::BuildGraphMetricsObject(const FGeoBlueprintJsonGraphMetrics& Metrics)
+{
+    FGeoJsonObject* MetricsObject = Arena.New<FGeoJsonObject>(Arena);
+    MetricsObject->SetNumberField(TEXT("Nodes"), Metrics.NumNodes);
+    MetricsObject->SetNumberField(TEXT("ExecNodes"), Metrics.NumExecNodes);
+    MetricsObject->SetNumberField(TEXT("ExecEdges"), Metrics.NumExecEdges);
+    MetricsObject->SetNumberField(TEXT("DataEdges"), Metrics.NumDataEdges);
+    MetricsObject->SetNumberField(TEXT("EntryPoints"), Metrics.NumEntryPoints);
+    MetricsObject->SetNumberField(TEXT("CyclomaticComplexity"), Metrics.CyclomaticComplexity);
+    MetricsObject->SetNumberField(TEXT("MaxFanIn"), Metrics.MaxFanIn);
+    if (Metrics.MaxFanInNode)
+    {
+        MetricsObject->SetStringField(TEXT("MaxFanInNodeGuid"), Metrics.MaxFanInNode->NodeGuid.ToString());
+    }
+    MetricsObject->SetNumberField(TEXT("MaxFanOut"), Metrics.MaxFanOut);
+    if (Metrics.MaxFanOutNode)
+    {
+        MetricsObject->SetStringField(TEXT("MaxFanOutNodeGuid"), Metrics.MaxFanOutNode->NodeGuid.ToString());
+    }
+    MetricsObject->SetNumberField(TEXT("LongestExecChain"), Metrics.LongestExecChain);
+    MetricsObject->SetNumberField(TEXT("StronglyConnectedComponents"), Metrics.NumStronglyConnectedComponents);
+    MetricsObject->SetNumberField(TEXT("ExecCycles"), Metrics.NumExecCycles);
+    MetricsObject->SetNumberField(TEXT("LargestExecCycle"), Metrics.LargestExecCycle);
+    MetricsObject->SetNumberField(TEXT("Casts"), Metrics.NumCasts);
+    MetricsObject->SetNumberField(TEXT("Loops"), Metrics.NumLoops);
+    MetricsObject->SetNumberField(TEXT("LatentNodes"), Metrics.NumLatentNodes);
+    return MetricsObject;
+}
+
+FGeoJsonObject* FGeoBlueprintJsonGraphExporter::BuildPureNodeCostObject(const FGeoBlueprintJsonPureNodeCost& Cost)
+{
+    FGeoJsonObject* CostObject = Arena.New<FGeoJsonObject>(Arena);
+    CostObject->SetStringField(TEXT("NodeGuid"), Cost.Node->NodeGuid.ToString());
+    CostObject->SetStringField(TEXT("NodeName"), FGeoBlueprintJsonNodeTitleCache::Get().GetTitle(Cost.Node));
+    CostObject->SetStringField(TEXT("NodeType"), Cost.Node->GetClass()->GetName());
+    CostObject->SetNumberField(TEXT("ImpureConsumers"), Cost.ImpureConsumers);
+    CostObject->SetNumberField(TEXT("EvaluationsPerExecution"), Cost.Evaluations);
+    CostObject->SetBoolField(TEXT("InLoop"), Cost.bInLoop);
+    CostObject->SetNumberField(TEXT("EstimatedCost"), Cost.EstimatedCost);
+    return CostObject;
+}
+
+FGeoJsonArray* FGeoBlueprintJsonGraphExporter::BuildPureNodeReport(UBlueprint* Blueprint, int32 MaxResults)
+{
+    FGeoJsonArray* ReportArray = Arena.New<FGeoJsonArray>(Arena);
+    if (!Blueprint)
+    {
+        return ReportArray;
+    }
+
+    TArray<UEdGraph*> Graphs;
+    Blueprint->GetAllGraphs(Graphs);
+
+    TArray<FGeoBlueprintJsonPureNodeCost> AllCosts;
+    for (const UEdGraph* Graph : Graphs)
+    {
+        AllCosts.Append(FGeoBlueprintJsonPureNodeAnalysis::AnalyzeGraph(Graph, Options.AssumedLoopIterations));
+    }
+
+    AllCosts.Sort([](const FGeoBlueprintJsonPureNodeCost& A, const FGeoBlueprintJsonPureNodeCost& B)
+    {
+        if (A.EstimatedCost != B.EstimatedCost)
+        {
+            return A.EstimatedCost > B.EstimatedCost;
+        }
+        return A.Node->NodeGuid < B.Node->NodeGuid;
+    });
+
+    for (int32 Index = 0; Index < AllCosts.Num() && Index < MaxResults; ++Index)
+    {
+        FGeoJsonObject* CostObject = BuildPureNodeCostObject(AllCosts[Index]);
+        CostObject->SetStringField(TEXT("GraphName"), AllCosts[Index].Node->GetGraph()->GetName());
+        ReportArray->AddObject(CostObject);
+    }
+    return ReportArray;
+}
+
+FGeoJsonObject* FGeoBlueprintJsonGraphExporter::BuildNodeObject(UEdGraphNode* Node)
+{
+    if (!Node)
+    {
+        return nullptr;
+    }
+
+    FGeoJsonObject* NodeObject = Arena.New<FGeoJsonObject>(Arena);
+
+    // Basic node information
+    NodeObject->SetStringField(TEXT("NodeName"), FGeoBlueprintJsonNodeTitleCache::Get().GetTitle(Node));
+    NodeObject->SetStringField(TEXT("NodeType"), Node->GetClass()->GetName());
+    NodeObject->SetStringField(TEXT("NodeGuid"), Node->NodeGuid.ToString());
+    if (Options.bIncludeContentHashes)
+    {
+        NodeObject->SetStringField(TEXT("ContentHash"), FGeoBlueprintJsonContentHasher::ToString(ContentHasher.HashNode(Node)));
+    }
+    NodeObject->SetNumberField(TEXT("NodeX"), Node->NodePosX);
+    NodeObject->SetNumberField(TEXT("NodeY"), Node->NodePosY);
+    NodeObject->SetStringField(TEXT("NodeComment"), Node->NodeComment);
+    NodeObject->SetBoolField(TEXT("AdvancedPinDisplay"), static_cast<bool>(Node->AdvancedPinDisplay));
+    NodeObject->SetBoolField(TEXT("EnabledState"), Node->IsNodeEnabled());
+
+    // Convert input pins
+    FGeoJsonArray* InputPinsArray = NodeObject->SetArrayField(TEXT("InputPins"));
+    for (UEdGraphPin* Pin : Node->Pins)
+    {
+        if (Pin && Pin->Direction == EGPD_Input)
+        {
+            if (FGeoJsonObject* PinObject = BuildPinObject(Pin))
+            {
+                InputPinsArray->AddObject(PinObject);
+            }
+        }
+    }
+
+    // Convert output pins
+    FGeoJsonArray* OutputPinsArray = NodeObject->SetArrayField(TEXT("OutputPins"));
+    for (UEdGraphPin* Pin : Node->Pins)
+    {
+        if (Pin && Pin->Direction == EGPD_Output)
+        {
+            if (FGeoJsonObject* PinObject = BuildPinObject(Pin))
+            {
+                OutputPinsArray->AddObject(PinObject);
+            }
+        }
+    }
+
+    // Add node-specific properties based on type
+    AddNodeSpecificFields(*NodeObject, Node);
+
+    AddHeatFields(*NodeObject, Node->GetTypedOuter<UBlueprint>(), Node->NodeGuid.ToString());
+
+    return NodeObject;
+}
+
+void FGeoBlueprintJsonGraphExporter::AddHeatFields(FGeoJsonObject& Object, const UBlueprint* Blueprint, const FString& Name)
+{
+    if (const FGeoBlueprintJsonHeat* Heat = FindHeat(Blueprint, Name))
+    {
+        Object.SetNumberField(TEXT("HitCount"), static_cast<double>(Heat->HitCount));
+        Object.SetNumberField(TEXT("TimeMs"), Heat->TimeMs);
+    }
+}
+
+void FGeoBlueprintJsonGraphExporter::AddGraphHeatFields(FGeoJsonObject& GraphObject, UEdGraph* Graph)
+{
+    const UBlueprint* Blueprint = Graph->GetTypedOuter<UBlueprint>();
+    if (FindHeat(Blueprint, Graph->GetName()))
+    {
+        AddHeatFields(GraphObject, Blueprint, Graph->GetName());
+        return;
+    }
+
+    // Only function graphs share a name with the function the profiler timed. Ubergraph pages and
+    // collapsed graphs compile into the ubergraph, so their heat is summed up from their nodes: the
+    // time of all of them, and the hit count of the node that ran most often.
+    FGeoBlueprintJsonHeat GraphHeat;
+    bool bHasHeat = false;
+    for (const UEdGraphNode* Node : Graph->Nodes)
+    {
+        if (const FGeoBlueprintJsonHeat* NodeHeat = Node ? FindHeat(Blueprint, Node->NodeGuid.ToString()) : nullptr)
+        {
+            GraphHeat.HitCount = FMath::Max(GraphHeat.HitCount, NodeHeat->HitCount);
+            GraphHeat.TimeMs += NodeHeat->TimeMs;
+            bHasHeat = true;
+        }
+    }
+
+    if (bHasHeat)
+    {
+        GraphObject.SetNumberField(TEXT("HitCount"), static_cast<double>(GraphHeat.HitCount));
+        GraphObject.SetNumberField(TEXT("TimeMs"), GraphHeat.TimeMs);
+    }
+}
+
+const FGeoBlueprintJsonHeat* FGeoBlueprintJsonGraphExporter::FindHeat(const UBlueprint* Blueprint, const FString& Name)
+{
+    if (!Blueprint || !bHeatDataEnabled)
+    {
+        return nullptr;
+    }
+
+    // Resolved on first use, so exports that never reach a graph or node don't pay for it. An explicit
+    // capture file wins; otherwise a capture running in this session is merged.
+    if (!HeatMap.IsValid())
+    {
+        HeatMap = !Options.HeatProfileFile.IsEmpty()
+            ? FGeoBlueprintJsonScriptProfiler::GetFileHeatMap(Options.HeatProfileFile)
+            : FGeoBlueprintJsonScriptProfiler::Get().GetHeatMap();
+    }
+    if (HeatMap->Num() == 0)
+    {
+        return nullptr;
+    }
+
+    return HeatMap->Find(FGeoBlueprintJsonScriptProfiler::MakeHeatKey(Blueprint->GetPathName(), Name));
+}
+
+void FGeoBlueprintJsonGraphExporter::AddNodeSpecificFields(FGeoJsonObject& NodeObject, UEdGraphNode* Node)
+{
+    if (Node->IsA<UAnimGraphNode_Base>())
+    {
+        if (Options.bIncludeAnimAnalysis)
+        {
+            const FGeoBlueprintJsonAnimNodeReport Report = FGeoBlueprintJsonAnimAnalysis::AnalyzeNode(Cast<UAnimGraphNode_Base>(Node));
+            NodeObject.SetBoolField(TEXT("FastPath"), Report.IsFastPath());
+            FGeoJsonArray* PinsArray = NodeObject.SetArrayField(TEXT("SlowPathPins"));
+            for (const FName PinName : Report.SlowPathPins)
+            {
+                PinsArray->AddString(PinName.ToString());
+            }
+        }
+    }
+    else if (Node->IsA<UK2Node_CallFunction>())
+    {
+        if (UK2Node_CallFunction* FunctionNode = Cast<UK2Node_CallFunction>(Node))
+        {
+            if (FunctionNode->FunctionReference.GetMemberParentClass())
+            {
+                NodeObject.SetStringField(TEXT("FunctionClass"), FunctionNode->FunctionReference.GetMemberParentClass()->GetName());
+            }
+            NodeObject.SetStringField(TEXT("FunctionName"), FunctionNode->FunctionReference.GetMemberName().ToString());
+            
+            if (UFunction* Function = FunctionNode->GetTargetFunction())
+            {
+                NodeObject.SetStringField(TEXT("FunctionSignature"), Function->GetName());
+                NodeObject.SetBoolField(TEXT("IsPureFunc"), Function->HasAnyFunctionFlags(FUNC_BlueprintPure));
+            }
+        }
+    }
+    else if (Node->IsA<UK2Node_DynamicCast>())
+    {
+        if (UK2Node_DynamicCast* CastNode = Cast<UK2Node_DynamicCast>(Node))
+        {
+            if (UClass* TargetType = CastNode->TargetType)
+            {
+                NodeObject.SetStringField(TEXT("CastToType"), TargetType->GetName());
+            }
+            NodeObject.SetBoolField(TEXT("IsPureCast"), CastNode->IsNodePure());
+        }
+    }
+    else if (Node->IsA<UK2Node_MacroInstance>())
+    {
+        if (UK2Node_MacroInstance* MacroNode = Cast<UK2Node_MacroInstance>(Node))
+        {
+            UEdGraph* MacroGraph = MacroNode->GetMacroGraph();
+            if (UBlueprint* MacroBlueprint = MacroGraph ? MacroGraph->GetTypedOuter<UBlueprint>() : nullptr)
+            {
+                NodeObject.SetStringField(TEXT("MacroName"), MacroBlueprint->GetName());
+            }
+        }
+    }
+    else if (Node->IsA<UK2Node_Timeline>())
+    {
+        if (UK2Node_Timeline* TimelineNode = Cast<UK2Node_Timeline>(Node))
+        {
+            NodeObject.SetStringField(TEXT("TimelineName"), TimelineNode->TimelineName.ToString());
+        }
+    }
+    else if (Node->IsA<UK2Node_SpawnActor>())
+    {
+        if (UK2Node_SpawnActor* SpawnNode = Cast<UK2Node_SpawnActor>(Node))
+        {
+            // Use public API to get spawn class
+            UClass* ClassToSpawn = nullptr;
+            for (UEdGraphPin* Pin : SpawnNode->Pins)
+            {
+                if (Pin && Pin->PinName == TEXT("Class"))
+                {
+                    if (Pin->DefaultObject)
+                    {
+                        ClassToSpawn = Cast<UClass>(Pin->DefaultObject);
+                        break;
+                    }
+                }
+            }
+            if (ClassToSpawn)
+            {
+                NodeObject.SetStringField(TEXT("ActorToSpawn"), ClassToSpawn->GetName());
+            }
+        }
+    }
+    else if (Node->IsA<UK2Node_VariableGet>())
+    {
+        if (UK2Node_VariableGet* GetNode = Cast<UK2Node_VariableGet>(Node))
+        {
+            NodeObject.SetStringField(TEXT("VariableName"), GetNode->VariableReference.GetMemberName().ToString());
+            if (GetNode->VariableReference.GetMemberParentClass())
+            {
+                NodeObject.SetStringField(TEXT("VariableClass"), GetNode->VariableReference.GetMemberParentClass()->GetName());
+            }
+        }
+    }
+    else if (Node->IsA<UK2Node_VariableSet>())
+    {
+        if (UK2Node_VariableSet* SetNode = Cast<UK2Node_VariableSet>(Node))
+        {
+            NodeObject.SetStringField(TEXT("VariableName"), SetNode->VariableReference.GetMemberName().ToString());
+            if (SetNode->VariableReference.GetMemberParentClass())
+            {
+                NodeObject.SetStringField(TEXT("VariableClass"), SetNode->VariableReference.GetMemberParentClass()->GetName());
+            }
+        }
+    }
+    else if (Node->IsA<UK2Node_Knot>())
+    {
+        if (UK2Node_Knot* KnotNode = Cast<UK2Node_Knot>(Node))
+        {
+            // Knot nodes are simple pass-through nodes, just add their basic info
+            NodeObject.SetBoolField(TEXT("IsKnot"), true);
+        }
+    }
+    else if (Node->IsA<UK2Node_Switch>())
+    {
+        if (UK2Node_Switch* SwitchNode = Cast<UK2Node_Switch>(Node))
+        {
+            // Add switch-specific properties
+            FGeoJsonArray* CasePinsArray = NodeObject.SetArrayField(TEXT("CasePins"));
+            for (UEdGraphPin* Pin : SwitchNode->Pins)
+            {
+                if (Pin && Pin->Direction == EGPD_Output && !Pin->PinName.ToString().Contains(TEXT("Default")))
+                {
+                    CasePinsArray->AddString(Pin->PinName.ToString());
+                }
+            }
+        }
+    }
+    else if (Node->IsA<UK2Node_CommutativeAssociativeBinaryOperator>())
+    {
+        if (UK2Node_CommutativeAssociativeBinaryOperator* OpNode = Cast<UK2Node_CommutativeAssociativeBinaryOperator>(Node))
+        {
+            // Add operator-specific properties
+            if (UFunction* OperatorFunction = OpNode->GetTargetFunction())
+            {
+                NodeObject.SetStringField(TEXT("OperatorFunction"), OperatorFunction->GetName());
+            }
+        }
+    }
+    else if (Node->IsA<UK2Node_Event>())
+    {
+        if (UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
+        {
+            if (EventNode->EventReference.GetMemberParentClass())
+            {
+                NodeObject.SetStringField(TEXT("EventClass"), EventNode->EventReference.GetMemberParentClass()->GetName());
+            }
+            NodeObject.SetStringField(TEXT("EventName"), EventNode->EventReference.GetMemberName().ToString());
+            
+            if (UFunction* Function = EventNode->FindEventSignatureFunction())
+            {
+                NodeObject.SetStringField(TEXT("EventSignature"), Function->GetName());
+            }
+        }
+    }
+    else if (Node->IsA<UK2Node_CustomEvent>())
+    {
+        if (UK2Node_CustomEvent* CustomEventNode = Cast<UK2Node_CustomEvent>(Node))
+        {
+            NodeObject.SetStringField(TEXT("CustomEventName"), CustomEventNode->CustomFunctionName.ToString());
+            
+            if (UFunction* Function = CustomEventNode->FindEventSignatureFunction())
+            {
+                NodeObject.SetStringField(TEXT("CustomEventSignature"), Function->GetName());
+            }
+        }
+    }
+    else if (Node->IsA<UK2Node_IfThenElse>())
+    {
+        if (UK2Node_IfThenElse* IfThenElseNode = Cast<UK2Node_IfThenElse>(Node))
+        {
+            for (UEdGraphPin* Pin : IfThenElseNode->Pins)
+            {
+                if (Pin)
+                {
+                    if (Pin->Direction == EGPD_Input && Pin->PinName.ToString().Contains(TEXT("Condition")))
+                    {
+                        NodeObject.SetStringField(TEXT("ConditionPin"), Pin->PinName.ToString());
+                    }
+                    else if (Pin->Direction == EGPD_Output && Pin->PinName.ToString().Contains(TEXT("Then")))
+                    {
+                        NodeObject.SetStringField(TEXT("ThenPin"), Pin->PinName.ToString());
+                    }
+                    else if (Pin->Direction == EGPD_Output && Pin->PinName.ToString().Contains(TEXT("Else")))
+                    {
+                        NodeObject.SetStringField(TEXT("ElsePin"), Pin->PinName.ToString());
+                    }
+                }
+            }
+        }
+    }
+    else if (Node->IsA<UK2Node_Select>())
+    {
+        if (UK2Node_Select* SelectNode = Cast<UK2Node_Select>(Node))
+        {
+            int32 NumOptions = 0;
+            for (UEdGraphPin* Pin : SelectNode->Pins)
+            {
+                if (Pin)
+                {
+                    if (Pin->Direction == EGPD_Input && Pin->PinName.ToString().Contains(TEXT("Index")))
+                    {
+                        NodeObject.SetStringField(TEXT("IndexPin"), Pin->PinName.ToString());
+                    }
+                    else if (Pin->Direction == EGPD_Output && Pin->PinName.ToString().Contains(TEXT("Selection")))
+                    {
+                        NodeObject.SetStringField(TEXT("SelectionPin"), Pin->PinName.ToString());
+                    }
+                    else if (Pin->Direction == EGPD_Input && Pin->PinName.ToString().StartsWith(TEXT("Option")))
+                    {
+                        NumOptions++;
+                    }
+                }
+            }
+            NodeObject.SetNumberField(TEXT("NumOptions"), NumOptions);
+        }
+    }
+    else if (Node->IsA<UK2Node_MakeArray>())
+    {
+        if (UK2Node_MakeArray* ArrayNode = Cast<UK2Node_MakeArray>(Node))
+        {
+            NodeObject.SetNumberField(TEXT("NumElements"), ArrayNode->NumInputs);
+            // Get array type from output pin
+            for (UEdGraphPin* Pin : ArrayNode->Pins)
+            {
+                if (Pin && Pin->Direction == EGPD_Output)
+                {
+                    NodeObject.SetStringField(TEXT("ArrayType"), Pin->PinType.PinCategory.ToString());
+                    break;
+                }
+            }
+        }
+    }
+    else if (Node->IsA<UK2Node_MakeStruct>())
+    {
+        if (UK2Node_MakeStruct* StructNode = Cast<UK2Node_MakeStruct>(Node))
+        {
+            // Get struct type from output pin
+            for (UEdGraphPin* Pin : StructNode->Pins)
+            {
+                if (Pin && Pin->Direction == EGPD_Output)
+                {
+                    if (UScriptStruct* Struct = Cast<UScriptStruct>(Pin->PinType.PinSubCategoryObject.Get()))
+                    {
+                        NodeObject.SetStringField(TEXT("StructType"), Struct->GetName());
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    else if (Node->IsA<UK2Node_BreakStruct>())
+    {
+        if (UK2Node_BreakStruct* BreakNode = Cast<UK2Node_BreakStruct>(Node))
+        {
+            // Get struct type from input pin
+            for (UEdGraphPin* Pin : BreakNode->Pins)
+            {
+                if (Pin && Pin->Direction == EGPD_Input)
+                {
+                    if (UScriptStruct* Struct = Cast<UScriptStruct>(Pin->PinType.PinSubCategoryObject.Get()))
+                    {
+                        NodeObject.SetStringField(TEXT("StructType"), Struct->GetName());
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    else if (Node->IsA<UK2Node_CallParentFunction>())
+    {
+        if (UK2Node_CallParentFunction* ParentNode = Cast<UK2Node_CallParentFunction>(Node))
+        {
+            if (UFunction* ParentFunction = ParentNode->GetTargetFunction())
+            {
+                NodeObject.SetStringField(TEXT("ParentFunction"), ParentFunction->GetName());
+                if (ParentFunction->GetOwnerClass())
+                {
+                    NodeObject.SetStringField(TEXT("ParentClass"), ParentFunction->GetOwnerClass()->GetName());
+                }
+            }
+        }
+    }
+}
+
+FGeoJsonObject* FGeoBlueprintJsonGraphExporter::BuildPinObject(UEdGraphPin* Pin)
+{
+    if (!Pin)
+    {
+        return nullptr;
+    }
+
+    FGeoJsonObject* PinObject = Arena.New<FGeoJsonObject>(Arena);
+
+    PinObject->SetStringField(TEXT("PinName"), Pin->PinName.ToString());
+    PinObject->SetStringField(TEXT("PinType"), Pin->PinType.PinCategory.ToString());
+    PinObject->SetStringField(TEXT("Direction"), Pin->Direction == EGPD_Input ? TEXT("Input") : TEXT("Output"));
+
+    // Convert connections
+    FGeoJsonArray* ConnectionsArray = PinObject->SetArrayField(TEXT("Connections"));
+    for (UEdGraphPin* ConnectedPin : Pin->LinkedTo)
+    {
+        if (FGeoJsonObject* ConnectionObject = BuildConnectionObject(ConnectedPin))
+        {
+            ConnectionsArray->AddObject(ConnectionObject);
+        }
+    }
+
+    return PinObject;
+}
+
+FGeoJsonObject* FGeoBlueprintJsonGraphExporter::BuildNeighborhoodObject(UEdGraphNode* Start, int32 MaxHops, EGeoBlueprintJsonEdgeFilter EdgeFilter, EGeoBlueprintJsonEdgeDirection Direction)
+{
+    using namespace GeoBlueprintJsonGraphExporter;
+
+    if (!Start)
+    {
+        return nullptr;
+    }
+    MaxHops = FMath::Max(0, MaxHops);
+
+    // Nodes doubles as the breadth-first queue, so it ends up ordered by hops
+    TMap<const UEdGraphNode*, int32> Hops;
+    TArray<UEdGraphNode*> Nodes;
+    Hops.Add(Start, 0);
+    Nodes.Add(Start);
+    for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+    {
+        const UEdGraphNode* Node = Nodes[Index];
+        const int32 NodeHops = Hops.FindChecked(Node);
+        if (NodeHops >= MaxHops)
+        {
+            continue;
+        }
+
+        for (const UEdGraphPin* Pin : Node->Pins)
+        {
+            if (!Pin || !IsFollowed(Pin, EdgeFilter, Direction))
+            {
+                continue;
+            }
+
+            for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+            {
+                UEdGraphNode* LinkedNode = LinkedPin ? LinkedPin->GetOwningNodeUnchecked() : nullptr;
+                if (LinkedNode && !Hops.Contains(LinkedNode))
+                {
+                    Hops.Add(LinkedNode, NodeHops + 1);
+                    Nodes.Add(LinkedNode);
+                }
+            }
+        }
+    }
+
+    FGeoJsonObject* NeighborhoodObject = Arena.New<FGeoJsonObject>(Arena);
+    NeighborhoodObject->SetStringField(TEXT("StartNodeGuid"), Start->NodeGuid.ToString());
+    NeighborhoodObject->SetStringField(TEXT("Graph"), GetGraphPath(Start->GetGraph()));
+    NeighborhoodObject->SetNumberField(TEXT("MaxHops"), MaxHops);
+    NeighborhoodObject->SetStringField(TEXT("EdgeFilter"), StaticEnum<EGeoBlueprintJsonEdgeFilter>()->GetNameStringByValue(static_cast<int64>(EdgeFilter)));
+    NeighborhoodObject->SetStringField(TEXT("Direction"), StaticEnum<EGeoBlueprintJsonEdgeDirection>()->GetNameStringByValue(static_cast<int64>(Direction)));
+
+    FGeoJsonArray* NodesArray = NeighborhoodObject->SetArrayField(TEXT("Nodes"));
+    for (UEdGraphNode* Node : Nodes)
+    {
+        if (FGeoJsonObject* NodeObject = BuildNodeObject(Node))
+        {
+            NodeObject->SetNumberField(TEXT("Hops"), Hops.FindChecked(Node));
+            NodesArray->AddObject(NodeObject);
+        }
+    }
+
+    // Every cut link is seen from its inside end only, so each one is listed once
+    FGeoJsonArray* BoundaryArray = NeighborhoodObject->SetArrayField(TEXT("Boundary"));
+    for (const UEdGraphNode* Node : Nodes)
+    {
+        for (const UEdGraphPin* Pin : Node->Pins)
+        {
+            if (!Pin)
+            {
+                continue;
+            }
+
+            for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+            {
+                const UEdGraphNode* LinkedNode = LinkedPin ? LinkedPin->GetOwningNodeUnchecked() : nullptr;
+                if (!LinkedNode || Hops.Contains(LinkedNode))
+                {
+                    continue;
+                }
+
+                FGeoJsonObject* EdgeObject = BoundaryArray->AddObject();
+                EdgeObject->SetStringField(TEXT("NodeGuid"), Node->NodeGuid.ToString());
+                EdgeObject->SetStringField(TEXT("PinName"), Pin->PinName.ToString());
+                EdgeObject->SetStringField(TEXT("PinType"), Pin->PinType.PinCategory.ToString());
+                EdgeObject->SetStringField(TEXT("Direction"), Pin->Direction == EGPD_Input ? TEXT("Input") : TEXT("Output"));
+                EdgeObject->SetStringField(TEXT("LinkedNodeGuid"), LinkedNode->NodeGuid.ToString());
+                EdgeObject->SetStringField(TEXT("LinkedNodeName"), FGeoBlueprintJsonNodeTitleCache::Get().GetTitle(LinkedNode));
+                EdgeObject->SetStringField(TEXT("LinkedPinName"), LinkedPin->PinName.ToString());
+                EdgeObject->SetStringField(TEXT("Reason"), IsFollowed(Pin, EdgeFilter, Direction) ? TEXT("HopLimit") : TEXT("Filtered"));
+            }
+        }
+    }
+
+    return NeighborhoodObject;
+}
+
+FGeoJsonObject* FGeoBlueprintJsonGraphExporter::BuildConnectionObject(UEdGraphPin* Pin)
+{
+    if (!Pin || !Pin->GetOwningNode())
+    {
+        return nullptr;
+    }
+
+    FGeoJsonObject* ConnectionObject = Arena.New<FGeoJsonObject>(Arena);
+
+    ConnectionObject->SetStringField(TEXT("NodeName"), FGeoBlueprintJsonNodeTitleCache::Get().GetTitle(Pin->GetOwningNode()));
+    ConnectionObject->SetStringField(TEXT("PinName"), Pin->PinName.ToString());
+    ConnectionObject->SetStringField(TEXT("PinType"), Pin->PinType.PinCategory.ToString());
+
+    return ConnectionObject;
+}
@@ -0,0 +1,157 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GeoBlueprintJsonContentHash.h"
+#include "GeoBlueprintJsonGraphFunctionLibrary.h"
+#include "GeoBlueprintJsonScriptProfiler.h"
+
+class FGeoJsonArena;
+class FGeoBlueprintJsonInheritanceCache;
+struct FGeoJsonArray;
+struct FGeoJsonObject;
+struct FGeoBlueprintJsonActorCost;
+struct FGeoBlueprintJsonAnimBlueprintReport;
+struct FGeoBlueprintJsonBindingCost;
+struct FGeoBlueprintJsonCompileProfile;
+struct FGeoBlueprintJsonWidgetBlueprintReport;
+struct FGeoBlueprintJsonComponentCost;
+struct FGeoBlueprintJsonGraphMetrics;
+struct FGeoBlueprintJsonPureNodeCost;
+struct FGeoBlueprintJsonReferenceReport;
+struct FGeoBlueprintJsonReplicationReport;
+class UBlueprint;
+class UEdGraph;
+class UEdGraphNode;
+class UEdGraphPin;
+
+/**
+ * Builds the graph export for Blueprints, graphs, nodes and pins into an arena-backed DOM.
+ * Everything the exporter produces lives in the arena passed to it, so a whole export is
+ * released with a single arena reset.
+ */
+class FGeoBlueprintJsonGraphExporter
+{
+public:
+    explicit FGeoBlueprintJsonGraphExporter(FGeoJsonArena& InArena, const FGeoBlueprintJsonGraphExportOptions& InOptions = FGeoBlueprintJsonGraphExportOptions());
+
+    FGeoJsonObject* BuildBlueprintObject(UBlueprint* Blueprint);
+
+    /**
+     * Exports each Blueprint against the records of its already exported parent: the header gains
+     * ParentBlueprint and a Defaults delta, and Components only lists what the Blueprint adds or
+     * changes. Every Blueprint built is added to the cache for its own children.
+     */
+    void SetInheritanceCache(FGeoBlueprintJsonInheritanceCache* InInheritanceCache) { InheritanceCache = InInheritanceCache; }
+
+    /** Leaves out HitCount/TimeMs, for results kept longer than the capture they would be merged from */
+    void SetHeatDataEnabled(bool bEnabled) { bHeatDataEnabled = bEnabled; }
+
+    /**
+     * The Blueprint fields of BuildBlueprintObject without its graph arrays and ContentHash. Add the hash
+     * with AddBlueprintContentHash once the graphs are exported, so it reuses their hashes.
+     */
+    FGeoJsonObject* BuildBlueprintHeaderObject(UBlueprint* Blueprint);
+
+    /** The header analyses, in the order BuildBlueprintHeaderObject adds them */
+    enum class EHeaderAnalysis : uint8
+    {
+        Animation,
+        WidgetTree,
+        Replication,
+        HardReferences,
+        Components,
+        Num
+    };
+
+    /**
+     * BuildBlueprintHeaderObject in steps, for callers that spread a Blueprint over several frames: the
+     * name, class and interface fields first, then each analysis the options enable
+     */
+    FGeoJsonObject* BeginBlueprintHeaderObject(UBlueprint* Blueprint);
+    void AddHeaderAnalysis(FGeoJsonObject& BlueprintObject, UBlueprint* Blueprint, EHeaderAnalysis Analysis);
+
+    /** Adds ContentHash when the options ask for it, from the graph hashes this exporter has already built */
+    void AddBlueprintContentHash(FGeoJsonObject& BlueprintObject, UBlueprint* Blueprint);
+
+    FGeoJsonObject* BuildGraphObject(UEdGraph* Graph, const TCHAR* GraphType);
+
+    /**
+     * BuildGraphObject in steps, for callers that spread a graph over several frames: the graph fields
+     * and an empty Nodes array first, then a BuildNodeObject for each node, then the graph analyses and
+     * ContentHash, which reuses the node hashes built along the way
+     */
+    FGeoJsonObject* BeginGraphObject(UEdGraph* Graph, const TCHAR* GraphType, FGeoJsonArray*& OutNodesArray);
+    void FinishGraphObject(FGeoJsonObject& GraphObject, UEdGraph* Graph);
+    FGeoJsonObject* BuildNodeObject(UEdGraphNode* Node);
+    FGeoJsonObject* BuildPinObject(UEdGraphPin* Pin);
+    FGeoJsonObject* BuildConnectionObject(UEdGraphPin* Pin);
+
+    /**
+     * The nodes within MaxHops followed links of Start, each with its Hops, and a Boundary entry for every
+     * link from them to a node left out: HopLimit where the link would have been followed, Filtered where
+     * its kind or direction is excluded. Nodes are found breadth-first from Start, so the cost grows with
+     * the neighborhood rather than the graph.
+     */
+    FGeoJsonObject* BuildNeighborhoodObject(UEdGraphNode* Start, int32 MaxHops, EGeoBlueprintJsonEdgeFilter EdgeFilter, EGeoBlueprintJsonEdgeDirection Direction);
+
+    FGeoJsonObject* BuildGraphMetricsObject(const FGeoBlueprintJsonGraphMetrics& Metrics);
+
+    /** Adds Components, the actor tick and EstimatedInstanceCost of an actor Blueprint */
+    void AddComponentFields(FGeoJsonObject& Object, const FGeoBlueprintJsonActorCost& ActorCost);
+    FGeoJsonObject* BuildComponentObject(const FGeoBlueprintJsonComponentCost& Cost);
+
+    /** The Animation summary of an Animation Blueprint: fast path counts, slow path nodes and function thread safety */
+    FGeoJsonObject* BuildAnimReportObject(const FGeoBlueprintJsonAnimBlueprintReport& Report);
+
+    /** Adds WidgetTree, Bindings and EstimatedBindingCost of a Widget Blueprint */
+    void AddWidgetFields(FGeoJsonObject& Object, const FGeoBlueprintJsonWidgetBlueprintReport& Report);
+    void AddBindingFields(FGeoJsonObject& Object, const FGeoBlueprintJsonBindingCost& Cost);
+
+    /** The Replication summary of an actor or component Blueprint: net settings, replicated properties and estimated bandwidth */
+    FGeoJsonObject* BuildReplicationObject(const FGeoBlueprintJsonReplicationReport& Report);
+
+    /** Adds HardReferences, each with the node or variable that introduced it, and the Blueprint's LoadClosure */
+    void AddReferenceFields(FGeoJsonObject& Object, const FGeoBlueprintJsonReferenceReport& Report);
+
+    /** Adds the compile times, bytecode size, diagnostics and RecompiledDependents of a compile profile */
+    void AddCompileProfileFields(FGeoJsonObject& Object, const FGeoBlueprintJsonCompileProfile& Profile);
+
+    /** Ranks pure nodes across every graph of a Blueprint, including collapsed subgraphs */
+    FGeoJsonArray* BuildPureNodeReport(UBlueprint* Blueprint, int32 MaxResults);
+
+    /** The Blueprint field BuildBlueprintObject lists graphs of the type under */
+    static const TCHAR* GetGraphArrayName(const TCHAR* GraphType);
+
+    /** Visits the graphs BuildBlueprintObject exports, in export order, with their graph type */
+    static void ForEachExportedGraph(UBlueprint* Blueprint, TFunctionRef<void(UEdGraph*, const TCHAR*)> Callback);
+
+    /**
+     * Names a graph uniquely within its Blueprint: the graph name for the Blueprint's own graphs, and
+     * a dotted path such as AnimGraph.AnimGraphNode_StateMachine_0.Locomotion.Idle for nested ones
+     */
+    static FString GetGraphPath(const UEdGraph* Graph);
+
+    /** Finds a node by GUID in the graphs BuildBlueprintObject exports, through the shared FGeoBlueprintJsonNodeGuidIndex */
+    static UEdGraphNode* FindNodeByGuid(UBlueprint* Blueprint, const FGuid& NodeGuid);
+
+private:
+    void AddInheritanceFields(FGeoJsonObject& BlueprintObject, UBlueprint* Blueprint);
+    void AddGraphArray(FGeoJsonObject& BlueprintObject, const TCHAR* FieldName, const TArray<TObjectPtr<UEdGraph>>& Graphs, const TCHAR* GraphType);
+    void AddNodeSpecificFields(FGeoJsonObject& NodeObject, UEdGraphNode* Node);
+    FGeoJsonObject* BuildPureNodeCostObject(const FGeoBlueprintJsonPureNodeCost& Cost);
+
+    /** Adds HitCount/TimeMs when the heat map has an entry for the named node or function of the Blueprint */
+    void AddHeatFields(FGeoJsonObject& Object, const UBlueprint* Blueprint, const FString& Name);
+
+    /** Adds the heat of the graph's function, or the heat of its nodes when it has no function of its own */
+    void AddGraphHeatFields(FGeoJsonObject& GraphObject, UEdGraph* Graph);
+
+    const FGeoBlueprintJsonHeat* FindHeat(const UBlueprint* Blueprint, const FString& Name);
+
+    FGeoJsonArena& Arena;
+    FGeoBlueprintJsonGraphExportOptions Options;
+    TSharedPtr<const FGeoBlueprintJsonHeatMap> HeatMap;
+    FGeoBlueprintJsonContentHasher ContentHasher;
+    FGeoBlueprintJsonInheritanceCache* InheritanceCache = nullptr;
+    bool bHeatDataEnabled = true;
+};
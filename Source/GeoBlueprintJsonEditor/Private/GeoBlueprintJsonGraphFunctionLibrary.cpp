@@ -0,0 +1,736 @@
+#include "GeoBlueprintJsonGraphFunctionLibrary.h"
+#include "GeoBlueprintJsonAnimAnalysis.h"
+#include "GeoBlueprintJsonBulkExport.h"
+#include "GeoBlueprintJsonBulkExporter.h"
+#include "GeoBlueprintJsonCompileProfiler.h"
+#include "GeoBlueprintJsonComponentAnalysis.h"
+#include "GeoBlueprintJsonContentHash.h"
+#include "GeoBlueprintJsonDom.h"
+#include "GeoBlueprintJsonGraphExporter.h"
+#include "GeoBlueprintJsonGraphMetrics.h"
+#include "GeoBlueprintJsonPackageTracker.h"
+#include "GeoBlueprintJsonReferenceAnalysis.h"
+#include "GeoBlueprintJsonReplicationAnalysis.h"
+#include "GeoBlueprintJsonWidgetAnalysis.h"
+#include "Algo/StableSort.h"
+#include "AssetRegistry/AssetData.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "K2Node.h"
+#include "Animation/AnimBlueprint.h"
+#include "Blueprint/BlueprintSupport.h"
+#include "Engine/Blueprint.h"
+#include "UObject/UObjectGlobals.h"
+#include "WidgetBlueprint.h"
+
+namespace GeoBlueprintJsonGraphFunctionLibrary
+{
+    /**
+     * Loads each Blueprint of the class under the package paths in turn, for the project-wide rankings.
+     * What the loop loaded itself is released again, so the editor's next GC can reclaim it.
+     */
+    static void ForEachBlueprintUnder(const TArray<FString>& PackagePaths, TFunctionRef<void(UBlueprint*, const FString&)> Callback, const UClass* BlueprintClass = UBlueprint::StaticClass())
+    {
+        FGeoBlueprintJsonBulkExportSettings Settings;
+        if (PackagePaths.Num() > 0)
+        {
+            Settings.PackagePaths = PackagePaths;
+        }
+
+        FGeoBlueprintJsonPackageTracker LoadedPackages;
+        const uint64 MemoryBudget = FPlatformMemory::GetConstants().TotalPhysical / 4 * 3;
+        for (const FAssetData& AssetData : FGeoBlueprintJsonBulkExporter::GatherBlueprintAssets(Settings))
+        {
+            // Filtered on the registry data, so other Blueprints are never loaded
+            if (!AssetData.IsInstanceOf(BlueprintClass))
+            {
+                continue;
+            }
+
+            if (UBlueprint* Blueprint = Cast<UBlueprint>(LoadedPackages.LoadAsset(AssetData)))
+            {
+                Callback(Blueprint, AssetData.GetObjectPathString());
+            }
+
+            // Rankings only keep what they built from each Blueprint, so commandlet runs can drop them as they go
+            if (IsRunningCommandlet() && FPlatformMemory::GetStats().UsedPhysical > MemoryBudget)
+            {
+                LoadedPackages.ReleasePackages();
+                CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+            }
+        }
+        LoadedPackages.ReleasePackages();
+    }
+
+    /**
+     * Collects the candidates of a project-wide ranking. Each candidate's fields are built as it is added,
+     * while its Blueprint is still loaded, since the analysis reports point into it. Serialize orders the
+     * candidates by score, highest first unless told otherwise, with a stable sort so that ties keep the
+     * asset path order. It writes the first MaxResults, each led by Rank and AssetPath.
+     */
+    template <typename ScoreType>
+    class TBlueprintRanking
+    {
+    public:
+        explicit TBlueprintRanking(FGeoJsonArena& InArena) : Arena(InArena) {}
+
+        void Add(const FString& AssetPath, const ScoreType& Score, TFunctionRef<void(FGeoJsonObject&)> BuildObject)
+        {
+            FCandidate& Candidate = Candidates.AddDefaulted_GetRef();
+            Candidate.AssetPath = AssetPath;
+            Candidate.Score = Score;
+            Candidate.Object = Arena.New<FGeoJsonObject>(Arena);
+            BuildObject(*Candidate.Object);
+        }
+
+        FString Serialize(int32 MaxResults)
+        {
+            return Serialize(MaxResults, [](const ScoreType& A, const ScoreType& B) { return B < A; });
+        }
+
+        template <typename CompareType>
+        FString Serialize(int32 MaxResults, CompareType IsRankedHigher)
+        {
+            Algo::StableSort(Candidates, [&IsRankedHigher](const FCandidate& A, const FCandidate& B)
+            {
+                return IsRankedHigher(A.Score, B.Score);
+            });
+
+            FGeoJsonArray ReportArray(Arena);
+            const int32 NumResults = MaxResults > 0 ? FMath::Min(MaxResults, Candidates.Num()) : Candidates.Num();
+            for (int32 Index = 0; Index < NumResults; ++Index)
+            {
+                const FCandidate& Candidate = Candidates[Index];
+                FGeoJsonObject* RankedObject = ReportArray.AddObject();
+                RankedObject->SetNumberField(TEXT("Rank"), Index + 1);
+                RankedObject->SetStringField(TEXT("AssetPath"), Candidate.AssetPath);
+                for (int32 FieldIndex = 0; FieldIndex < Candidate.Object->Fields.Num; ++FieldIndex)
+                {
+                    const FGeoJsonField& Field = Candidate.Object->Fields.Data[FieldIndex];
+                    RankedObject->SetField(Field.Key.View(), Field.Value);
+                }
+            }
+
+            FString OutputString;
+            ReportArray.Serialize(OutputString);
+            return OutputString;
+        }
+
+    private:
+        struct FCandidate
+        {
+            FString AssetPath;
+            ScoreType Score;
+            FGeoJsonObject* Object = nullptr;
+        };
+
+        FGeoJsonArena& Arena;
+        TArray<FCandidate> Candidates;
+    };
+}
+
+FString UGeoBlueprintJsonGraphFunctionLibrary::ConvertBlueprintGraphToJson(UBlueprint* Blueprint)
+{
+    return ConvertBlueprintGraphToJsonWithOptions(Blueprint, FGeoBlueprintJsonGraphExportOptions());
+}
+
+FString UGeoBlueprintJsonGraphFunctionLibrary::ConvertBlueprintGraphToJsonWithOptions(UBlueprint* Blueprint, const FGeoBlueprintJsonGraphExportOptions& Options)
+{
+    if (!Blueprint)
+    {
+        return TEXT("");
+    }
+
+    FGeoJsonArena Arena;
+    FGeoBlueprintJsonGraphExporter Exporter(Arena, Options);
+    FGeoJsonObject* BlueprintObject = Exporter.BuildBlueprintObject(Blueprint);
+
+    FString OutputString;
+    BlueprintObject->Serialize(OutputString);
+    return OutputString;
+}
+
+FString UGeoBlueprintJsonGraphFunctionLibrary::AnalyzePureNodeEvaluations(UBlueprint* Blueprint, int32 MaxResults, int32 AssumedLoopIterations)
+{
+    if (!Blueprint)
+    {
+        return TEXT("");
+    }
+
+    FGeoBlueprintJsonGraphExportOptions Options;
+    Options.AssumedLoopIterations = AssumedLoopIterations;
+
+    FGeoJsonArena Arena;
+    FGeoBlueprintJsonGraphExporter Exporter(Arena, Options);
+    FGeoJsonArray* ReportArray = Exporter.BuildPureNodeReport(Blueprint, MaxResults);
+
+    FString OutputString;
+    ReportArray->Serialize(OutputString);
+    return OutputString;
+}
+
+FString UGeoBlueprintJsonGraphFunctionLibrary::AnalyzeGraphMetrics(UBlueprint* Blueprint)
+{
+    if (!Blueprint)
+    {
+        return TEXT("");
+    }
+
+    FGeoJsonArena Arena;
+    FGeoBlueprintJsonGraphExporter Exporter(Arena);
+    FGeoJsonArray ReportArray(Arena);
+    FGeoBlueprintJsonGraphExporter::ForEachExportedGraph(Blueprint, [&](UEdGraph* Graph, const TCHAR* GraphType)
+    {
+        FGeoJsonObject* GraphObject = ReportArray.AddObject();
+        GraphObject->SetStringField(TEXT("GraphName"), Graph->GetName());
+        GraphObject->SetStringField(TEXT("GraphType"), GraphType);
+        GraphObject->SetObjectField(TEXT("Metrics"), Exporter.BuildGraphMetricsObject(FGeoBlueprintJsonGraphMetricsAnalysis::AnalyzeGraph(Graph)));
+    });
+
+    FString OutputString;
+    ReportArray.Serialize(OutputString);
+    return OutputString;
+}
+
+FString UGeoBlueprintJsonGraphFunctionLibrary::RankGraphMetrics(const TArray<FString>& PackagePaths, int32 MaxResults)
+{
+    FGeoJsonArena Arena;
+    FGeoBlueprintJsonGraphExporter Exporter(Arena);
+    GeoBlueprintJsonGraphFunctionLibrary::TBlueprintRanking<TTuple<int32, int32>> Ranking(Arena);
+
+    GeoBlueprintJsonGraphFunctionLibrary::ForEachBlueprintUnder(PackagePaths, [&](UBlueprint* Blueprint, const FString& AssetPath)
+    {
+        FGeoBlueprintJsonGraphExporter::ForEachExportedGraph(Blueprint, [&](UEdGraph* Graph, const TCHAR* GraphType)
+        {
+            const FGeoBlueprintJsonGraphMetrics Metrics = FGeoBlueprintJsonGraphMetricsAnalysis::AnalyzeGraph(Graph);
+            Ranking.Add(AssetPath, MakeTuple(Metrics.CyclomaticComplexity, Metrics.LongestExecChain), [&](FGeoJsonObject& Object)
+            {
+                Object.SetStringField(TEXT("GraphName"), Graph->GetName());
+                Object.SetStringField(TEXT("GraphType"), GraphType);
+                Object.SetObjectField(TEXT("Metrics"), Exporter.BuildGraphMetricsObject(Metrics));
+            });
+        });
+    });
+
+    return Ranking.Serialize(MaxResults);
+}
+
+FString UGeoBlueprintJsonGraphFunctionLibrary::AnalyzeComponentCosts(UBlueprint* Blueprint)
+{
+    if (!Blueprint)
+    {
+        return TEXT("");
+    }
+
+    FGeoJsonArena Arena;
+    FGeoBlueprintJsonGraphExporter Exporter(Arena);
+    FGeoJsonObject ReportObject(Arena);
+    Exporter.AddComponentFields(ReportObject, FGeoBlueprintJsonComponentAnalysis::AnalyzeBlueprint(Blueprint));
+
+    FString OutputString;
+    ReportObject.Serialize(OutputString);
+    return OutputString;
+}
+
+FString UGeoBlueprintJsonGraphFunctionLibrary::RankComponentCosts(const TArray<FString>& PackagePaths, int32 MaxResults)
+{
+    FGeoJsonArena Arena;
+    GeoBlueprintJsonGraphFunctionLibrary::TBlueprintRanking<double> Ranking(Arena);
+
+    GeoBlueprintJsonGraphFunctionLibrary::ForEachBlueprintUnder(PackagePaths, [&](UBlueprint* Blueprint, const FString& AssetPath)
+    {
+        const FGeoBlueprintJsonActorCost ActorCost = FGeoBlueprintJsonComponentAnalysis::AnalyzeBlueprint(Blueprint);
+        if (!ActorCost.bIsActor)
+        {
+            return;
+        }
+
+        Ranking.Add(AssetPath, ActorCost.EstimatedCost, [&](FGeoJsonObject& Object)
+        {
+            Object.SetNumberField(TEXT("EstimatedInstanceCost"), ActorCost.EstimatedCost);
+            Object.SetBoolField(TEXT("ActorTickEnabled"), ActorCost.bActorTickEnabled);
+            Object.SetNumberField(TEXT("Components"), ActorCost.Components.Num());
+            Object.SetNumberField(TEXT("TickingComponents"), ActorCost.NumTicking);
+            Object.SetNumberField(TEXT("OverlappingComponents"), ActorCost.NumOverlapping);
+            Object.SetNumberField(TEXT("SimulatingComponents"), ActorCost.NumSimulatingPhysics);
+            Object.SetNumberField(TEXT("ShadowCasters"), ActorCost.NumShadowCasters);
+        });
+    });
+
+    return Ranking.Serialize(MaxResults);
+}
+
+FString UGeoBlueprintJsonGraphFunctionLibrary::AnalyzeAnimBlueprint(UBlueprint* Blueprint)
+{
+    const FGeoBlueprintJsonAnimBlueprintReport Report = FGeoBlueprintJsonAnimAnalysis::AnalyzeBlueprint(Blueprint);
+    if (!Report.bIsAnimBlueprint)
+    {
+        return TEXT("");
+    }
+
+    FGeoJsonArena Arena;
+    FGeoBlueprintJsonGraphExporter Exporter(Arena);
+    FString OutputString;
+    Exporter.BuildAnimReportObject(Report)->Serialize(OutputString);
+    return OutputString;
+}
+
+FString UGeoBlueprintJsonGraphFunctionLibrary::RankAnimBlueprints(const TArray<FString>& PackagePaths, int32 MaxResults)
+{
+    FGeoJsonArena Arena;
+    FGeoBlueprintJsonGraphExporter Exporter(Arena);
+    GeoBlueprintJsonGraphFunctionLibrary::TBlueprintRanking<TTuple<int32, int32>> Ranking(Arena);
+
+    GeoBlueprintJsonGraphFunctionLibrary::ForEachBlueprintUnder(PackagePaths, [&](UBlueprint* Blueprint, const FString& AssetPath)
+    {
+        const FGeoBlueprintJsonAnimBlueprintReport Report = FGeoBlueprintJsonAnimAnalysis::AnalyzeBlueprint(Blueprint);
+        if (!Report.bIsAnimBlueprint)
+        {
+            return;
+        }
+
+        Ranking.Add(AssetPath, MakeTuple(Report.NumSlowPathNodes, Report.NumThreadSafetyViolations), [&](FGeoJsonObject& Object)
+        {
+            Object.SetObjectField(TEXT("Animation"), Exporter.BuildAnimReportObject(Report));
+        });
+    }, UAnimBlueprint::StaticClass());
+
+    return Ranking.Serialize(MaxResults);
+}
+
+FString UGeoBlueprintJsonGraphFunctionLibrary::AnalyzeWidgetBindings(UBlueprint* Blueprint)
+{
+    const FGeoBlueprintJsonWidgetBlueprintReport Report = FGeoBlueprintJsonWidgetAnalysis::AnalyzeBlueprint(Blueprint);
+    if (!Report.bIsWidgetBlueprint)
+    {
+        return TEXT("");
+    }
+
+    FGeoJsonArena Arena;
+    FGeoBlueprintJsonGraphExporter Exporter(Arena);
+    FGeoJsonObject ReportObject(Arena);
+    Exporter.AddWidgetFields(ReportObject, Report);
+
+    FString OutputString;
+    ReportObject.Serialize(OutputString);
+    return OutputString;
+}
+
+FString UGeoBlueprintJsonGraphFunctionLibrary::RankWidgetBindings(const TArray<FString>& PackagePaths, int32 MaxResults)
+{
+    FGeoJsonArena Arena;
+    FGeoBlueprintJsonGraphExporter Exporter(Arena);
+    GeoBlueprintJsonGraphFunctionLibrary::TBlueprintRanking<double> Ranking(Arena);
+
+    GeoBlueprintJsonGraphFunctionLibrary::ForEachBlueprintUnder(PackagePaths, [&](UBlueprint* Blueprint, const FString& AssetPath)
+    {
+        const FGeoBlueprintJsonWidgetBlueprintReport Report = FGeoBlueprintJsonWidgetAnalysis::AnalyzeBlueprint(Blueprint);
+        for (const FGeoBlueprintJsonBindingCost& Cost : Report.Bindings)
+        {
+            Ranking.Add(AssetPath, Cost.EstimatedCost, [&](FGeoJsonObject& Object)
+            {
+                Exporter.AddBindingFields(Object, Cost);
+            });
+        }
+    }, UWidgetBlueprint::StaticClass());
+
+    return Ranking.Serialize(MaxResults);
+}
+
+FString UGeoBlueprintJsonGraphFunctionLibrary::AnalyzeReplication(UBlueprint* Blueprint)
+{
+    const FGeoBlueprintJsonReplicationReport Report = FGeoBlueprintJsonReplicationAnalysis::AnalyzeBlueprint(Blueprint);
+    if (!Report.bIsReplicable)
+    {
+        return TEXT("");
+    }
+
+    FGeoJsonArena Arena;
+    FGeoBlueprintJsonGraphExporter Exporter(Arena);
+    FString OutputString;
+    Exporter.BuildReplicationObject(Report)->Serialize(OutputString);
+    return OutputString;
+}
+
+FString UGeoBlueprintJsonGraphFunctionLibrary::RankReplicationCosts(const TArray<FString>& PackagePaths, int32 MaxResults)
+{
+    FGeoJsonArena Arena;
+    FGeoBlueprintJsonGraphExporter Exporter(Arena);
+    GeoBlueprintJsonGraphFunctionLibrary::TBlueprintRanking<TTuple<double, int32>> Ranking(Arena);
+
+    GeoBlueprintJsonGraphFunctionLibrary::ForEachBlueprintUnder(PackagePaths, [&](UBlueprint* Blueprint, const FString& AssetPath)
+    {
+        // Classes that neither replicate nor declare replicated variables send nothing worth ranking
+        const FGeoBlueprintJsonReplicationReport Report = FGeoBlueprintJsonReplicationAnalysis::AnalyzeBlueprint(Blueprint);
+        if (!Report.bIsReplicable || (!Report.bReplicates && Report.NumBlueprintProperties == 0))
+        {
+            return;
+        }
+
+        Ranking.Add(AssetPath, MakeTuple(Report.EstimatedBytesPerSecond, Report.EstimatedBytesPerUpdate), [&](FGeoJsonObject& Object)
+        {
+            Object.SetObjectField(TEXT("Replication"), Exporter.BuildReplicationObject(Report));
+        });
+    });
+
+    return Ranking.Serialize(MaxResults);
+}
+
+FString UGeoBlueprintJsonGraphFunctionLibrary::AnalyzeHardReferences(UBlueprint* Blueprint)
+{
+    if (!Blueprint)
+    {
+        return TEXT("");
+    }
+
+    FGeoJsonArena Arena;
+    FGeoBlueprintJsonGraphExporter Exporter(Arena);
+    FGeoJsonObject ReportObject(Arena);
+    Exporter.AddReferenceFields(ReportObject, FGeoBlueprintJsonReferenceAnalysis::AnalyzeBlueprint(Blueprint));
+
+    FString OutputString;
+    ReportObject.Serialize(OutputString);
+    return OutputString;
+}
+
+FString UGeoBlueprintJsonGraphFunctionLibrary::RankLoadCosts(const TArray<FString>& PackagePaths, int32 MaxResults)
+{
+    FGeoJsonArena Arena;
+    FGeoBlueprintJsonGraphExporter Exporter(Arena);
+    GeoBlueprintJsonGraphFunctionLibrary::TBlueprintRanking<TTuple<int64, int32>> Ranking(Arena);
+
+    // Blueprints under the same paths mostly reference the same packages, so their closures are walked once per run
+    FGeoBlueprintJsonLoadClosureCache ClosureCache;
+    GeoBlueprintJsonGraphFunctionLibrary::ForEachBlueprintUnder(PackagePaths, [&](UBlueprint* Blueprint, const FString& AssetPath)
+    {
+        const FGeoBlueprintJsonReferenceReport Report = FGeoBlueprintJsonReferenceAnalysis::AnalyzeBlueprint(Blueprint, &ClosureCache);
+        Ranking.Add(AssetPath, MakeTuple(Report.Closure.DiskBytes, Report.Closure.NumPackages), [&](FGeoJsonObject& Object)
+        {
+            Exporter.AddReferenceFields(Object, Report);
+        });
+    });
+
+    return Ranking.Serialize(MaxResults);
+}
+
+FString UGeoBlueprintJsonGraphFunctionLibrary::ProfileBlueprintCompile(UBlueprint* Blueprint, int32 Iterations)
+{
+    if (!Blueprint)
+    {
+        return TEXT("");
+    }
+
+    FGeoJsonArena Arena;
+    FGeoBlueprintJsonGraphExporter Exporter(Arena);
+    FGeoJsonObject ReportObject(Arena);
+    Exporter.AddCompileProfileFields(ReportObject, FGeoBlueprintJsonCompileProfiler::ProfileBlueprint(Blueprint, Iterations));
+
+    FString OutputString;
+    ReportObject.Serialize(OutputString);
+    return OutputString;
+}
+
+FString UGeoBlueprintJsonGraphFunctionLibrary::RankBlueprintCompileTimes(const TArray<FString>& PackagePaths, int32 MaxResults, int32 Iterations)
+{
+    FGeoJsonArena Arena;
+    FGeoBlueprintJsonGraphExporter Exporter(Arena);
+    GeoBlueprintJsonGraphFunctionLibrary::TBlueprintRanking<double> Ranking(Arena);
+
+    // Assets come in package name order, so two runs over the same content compile in the same order
+    GeoBlueprintJsonGraphFunctionLibrary::ForEachBlueprintUnder(PackagePaths, [&](UBlueprint* Blueprint, const FString& AssetPath)
+    {
+        const FGeoBlueprintJsonCompileProfile Profile = FGeoBlueprintJsonCompileProfiler::ProfileBlueprint(Blueprint, Iterations);
+        if (Profile.Iterations == 0)
+        {
+            return;
+        }
+
+        Ranking.Add(AssetPath, Profile.Median.FullCompileMs, [&](FGeoJsonObject& Object)
+        {
+            Exporter.AddCompileProfileFields(Object, Profile);
+        });
+    });
+
+    return Ranking.Serialize(MaxResults);
+}
+
+FString UGeoBlueprintJsonGraphFunctionLibrary::ConvertBlueprintNodeToJson(UEdGraphNode* Node)
+{
+    if (!Node)
+    {
+        return TEXT("");
+    }
+
+    FGeoJsonArena Arena;
+    FGeoBlueprintJsonGraphExporter Exporter(Arena);
+    FGeoJsonObject* NodeObject = Exporter.BuildNodeObject(Node);
+    if (!NodeObject)
+    {
+        return TEXT("");
+    }
+
+    FString OutputString;
+    NodeObject->Serialize(OutputString);
+    return OutputString;
+}
+
+FString UGeoBlueprintJsonGraphFunctionLibrary::ConvertNodeNeighborhoodToJson(UEdGraphNode* Node, int32 MaxHops, EGeoBlueprintJsonEdgeFilter EdgeFilter, EGeoBlueprintJsonEdgeDirection Direction)
+{
+    if (!Node)
+    {
+        return TEXT("");
+    }
+
+    // Merging heat data would resolve the whole capture for a handful of nodes
+    FGeoJsonArena Arena;
+    FGeoBlueprintJsonGraphExporter Exporter(Arena);
+    Exporter.SetHeatDataEnabled(false);
+    FString OutputString;
+    Exporter.BuildNeighborhoodObject(Node, MaxHops, EdgeFilter, Direction)->Serialize(OutputString);
+    return OutputString;
+}
+
+FString UGeoBlueprintJsonGraphFunctionLibrary::ConvertNodeNeighborhoodToJsonByGuid(UBlueprint* Blueprint, const FString& NodeGuid, int32 MaxHops, EGeoBlueprintJsonEdgeFilter EdgeFilter, EGeoBlueprintJsonEdgeDirection Direction)
+{
+    FGuid Guid;
+    if (!FGuid::Parse(NodeGuid, Guid))
+    {
+        return TEXT("");
+    }
+    return ConvertNodeNeighborhoodToJson(FGeoBlueprintJsonGraphExporter::FindNodeByGuid(Blueprint, Guid), MaxHops, EdgeFilter, Direction);
+}
+
+FString UGeoBlueprintJsonGraphFunctionLibrary::GetNodeContentHash(UEdGraphNode* Node, bool bIncludeLayout)
+{
+    if (!Node)
+    {
+        return TEXT("");
+    }
+
+    FGeoBlueprintJsonContentHasher Hasher(bIncludeLayout);
+    return FGeoBlueprintJsonContentHasher::ToString(Hasher.HashNode(Node));
+}
+
+FString UGeoBlueprintJsonGraphFunctionLibrary::GetGraphContentHash(UEdGraph* Graph, bool bIncludeLayout)
+{
+    if (!Graph)
+    {
+        return TEXT("");
+    }
+
+    FGeoBlueprintJsonContentHasher Hasher(bIncludeLayout);
+    return FGeoBlueprintJsonContentHasher::ToString(Hasher.HashGraph(Graph));
+}
+
+FString UGeoBlueprintJsonGraphFunctionLibrary::GetBlueprintContentHash(UBlueprint* Blueprint, bool bIncludeLayout)
+{
+    if (!Blueprint)
+    {
+        return TEXT("");
+    }
+
+    FGeoBlueprintJsonContentHasher Hasher(bIncludeLayout);
+    return FGeoBlueprintJsonContentHasher::ToString(Hasher.HashBlueprint(Blueprint));
+}
+
+FString UGeoBlueprintJsonGraphFunctionLibrary::ConvertBlueprintPinToJson(UEdGraphPin* Pin)
+{
+    if (!Pin)
+    {
+        return TEXT("");
+    }
+
+    FGeoJsonArena Arena;
+    FGeoBlueprintJsonGraphExporter Exporter(Arena);
+    FGeoJsonObject* PinObject = Exporter.BuildPinObject(Pin);
+    if (!PinObject)
+    {
+        return TEXT("");
+    }
+
+    FString OutputString;
+    PinObject->Serialize(OutputString);
+    return OutputString;
+}
+
+TSharedPtr<FJsonObject> UGeoBlueprintJsonGraphFunctionLibrary::ConvertNodeToJsonObject(UEdGraphNode* Node)
+{
+    FGeoJsonArena Arena;
+    FGeoBlueprintJsonGraphExporter Exporter(Arena);
+    FGeoJsonObject* NodeObject = Exporter.BuildNodeObject(Node);
+    return NodeObject ? NodeObject->ToJsonObject().ToSharedPtr() : nullptr;
+}
+
+TSharedPtr<FJsonObject> UGeoBlueprintJsonGraphFunctionLibrary::ConvertPinToJsonObject(UEdGraphPin* Pin)
+{
+    FGeoJsonArena Arena;
+    FGeoBlueprintJsonGraphExporter Exporter(Arena);
+    FGeoJsonObject* PinObject = Exporter.BuildPinObject(Pin);
+    return PinObject ? PinObject->ToJsonObject().ToSharedPtr() : nullptr;
+}
+
+TSharedPtr<FJsonObject> UGeoBlueprintJsonGraphFunctionLibrary::ConvertConnectionToJsonObject(UEdGraphPin* Pin)
+{
+    FGeoJsonArena Arena;
+    FGeoBlueprintJsonGraphExporter Exporter(Arena);
+    FGeoJsonObject* ConnectionObject = Exporter.BuildConnectionObject(Pin);
+    return ConnectionObject ? ConnectionObject->ToJsonObject().ToSharedPtr() : nullptr;
+}
+
+FString UGeoBlueprintJsonGraphFunctionLibrary::ExportAllAvailableNodesAsJson()
+{
+    TArray<TSharedPtr<FJsonValue>> AllNodesArray;
+    
+    // Get all classes that derive from UK2Node
+    TArray<UClass*> K2NodeClasses;
+    GetDerivedClasses(UK2Node::StaticClass(), K2NodeClasses);
+    
+    // Process K2Node classes
+    for (UClass* NodeClass : K2NodeClasses)
+    {
+        if (!NodeClass || NodeClass->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists))
+            continue;
+            
+        TSharedPtr<FJsonObject> NodeObject = MakeShareable(new FJsonObject);
+        
+        // Basic node information
+        NodeObject->SetStringField(TEXT("node_type"), NodeClass->GetName());
+        NodeObject->SetStringField(TEXT("display_name"), NodeClass->GetDisplayNameText().ToString());
+        NodeObject->SetStringField(TEXT("category"), TEXT("K2Node"));
+        
+        // Get node tooltip
+        FString Tooltip;
+        if (NodeClass->HasMetaData(TEXT("Tooltip")))
+        {
+            Tooltip = NodeClass->GetMetaData(TEXT("Tooltip"));
+        }
+        NodeObject->SetStringField(TEXT("tooltip"), Tooltip);
+        
+        // Get node keywords for search
+        FString Keywords;
+        if (NodeClass->HasMetaData(TEXT("Keywords")))
+        {
+            Keywords = NodeClass->GetMetaData(TEXT("Keywords"));
+        }
+        NodeObject->SetStringField(TEXT("keywords"), Keywords);
+        
+        // Get node category
+        FString Category;
+        if (NodeClass->HasMetaData(TEXT("Category")))
+        {
+            Category = NodeClass->GetMetaData(TEXT("Category"));
+        }
+        NodeObject->SetStringField(TEXT("category_path"), Category);
+        
+        // Get node pins if it's a K2Node
+        if (UK2Node* K2Node = Cast<UK2Node>(NodeClass->GetDefaultObject()))
+        {
+            TArray<TSharedPtr<FJsonValue>> PinsArray;
+            for (UEdGraphPin* Pin : K2Node->Pins)
+            {
+                TSharedPtr<FJsonObject> PinObject = MakeShareable(new FJsonObject);
+                PinObject->SetStringField(TEXT("name"), Pin->PinName.ToString());
+                PinObject->SetStringField(TEXT("direction"), Pin->Direction == EGPD_Input ? TEXT("Input") : TEXT("Output"));
+                PinObject->SetStringField(TEXT("type"), Pin->PinType.PinCategory.ToString());
+                PinObject->SetStringField(TEXT("sub_type"), Pin->PinType.PinSubCategory.ToString());
+                PinObject->SetBoolField(TEXT("is_array"), Pin->PinType.IsArray());
+                PinObject->SetBoolField(TEXT("is_reference"), Pin->PinType.bIsReference);
+                
+                PinsArray.Add(MakeShareable(new FJsonValueObject(PinObject)));
+            }
+            NodeObject->SetArrayField(TEXT("pins"), PinsArray);
+        }
+        
+        AllNodesArray.Add(MakeShareable(new FJsonValueObject(NodeObject)));
+    }
+    
+    // Get all available Blueprint function libraries and their functions
+    TArray<UClass*> FunctionLibraryClasses;
+    GetDerivedClasses(UBlueprintFunctionLibrary::StaticClass(), FunctionLibraryClasses);
+    
+    for (UClass* LibraryClass : FunctionLibraryClasses)
+    {
+        if (!LibraryClass || LibraryClass->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists))
+            continue;
+        
+        // Get all UFUNCTIONs in the class
+        for (TFieldIterator<UFunction> FuncIt(LibraryClass); FuncIt; ++FuncIt)
+        {
+            UFunction* Function = *FuncIt;
+            if (!Function || Function->HasAnyFunctionFlags(FUNC_Private | FUNC_Protected))
+                continue;
+                
+            // Check if the function is marked as BlueprintCallable or BlueprintPure
+            if (!Function->HasAnyFunctionFlags(FUNC_BlueprintCallable | FUNC_BlueprintPure))
+                continue;
+                
+            TSharedPtr<FJsonObject> NodeObject = MakeShareable(new FJsonObject);
+            
+            // Basic node information
+            NodeObject->SetStringField(TEXT("node_type"), TEXT("K2Node_CallFunction"));
+            NodeObject->SetStringField(TEXT("function_name"), Function->GetName());
+            NodeObject->SetStringField(TEXT("class_name"), LibraryClass->GetName());
+            NodeObject->SetStringField(TEXT("display_name"), Function->GetDisplayNameText().ToString());
+            NodeObject->SetStringField(TEXT("category"), TEXT("BlueprintFunction"));
+            
+            // Get function tooltip
+            FString Tooltip;
+            if (Function->HasMetaData(TEXT("Tooltip")))
+            {
+                Tooltip = Function->GetMetaData(TEXT("Tooltip"));
+            }
+            NodeObject->SetStringField(TEXT("tooltip"), Tooltip);
+            
+            // Get function keywords for search
+            FString Keywords;
+            if (Function->HasMetaData(TEXT("Keywords")))
+            {
+                Keywords = Function->GetMetaData(TEXT("Keywords"));
+            }
+            NodeObject->SetStringField(TEXT("keywords"), Keywords);
+            
+            // Get function category
+            FString Category;
+            if (Function->HasMetaData(TEXT("Category")))
+            {
+                Category = Function->GetMetaData(TEXT("Category"));
+            }
+            NodeObject->SetStringField(TEXT("category_path"), Category);
+            
+            // Get function parameters
+            TArray<TSharedPtr<FJsonValue>> ParametersArray;
+            for (TFieldIterator<FProperty> PropIt(Function); PropIt; ++PropIt)
+            {
+                FProperty* Property = *PropIt;
+                if (!Property || !Property->HasAnyPropertyFlags(CPF_Parm))
+                    continue;
+                    
+                TSharedPtr<FJsonObject> ParamObject = MakeShareable(new FJsonObject);
+                ParamObject->SetStringField(TEXT("name"), Property->GetName());
+                ParamObject->SetStringField(TEXT("type"), Property->GetClass()->GetName());
+                ParamObject->SetStringField(TEXT("display_name"), Property->GetDisplayNameText().ToString());
+                ParamObject->SetStringField(TEXT("direction"), Property->HasAnyPropertyFlags(CPF_ReturnParm) ? TEXT("Return") : 
+                    Property->HasAnyPropertyFlags(CPF_OutParm) ? TEXT("Output") : TEXT("Input"));
+                
+                ParametersArray.Add(MakeShareable(new FJsonValueObject(ParamObject)));
+            }
+            NodeObject->SetArrayField(TEXT("parameters"), ParametersArray);
+            
+            AllNodesArray.Add(MakeShareable(new FJsonValueObject(NodeObject)));
+        }
+    }
+    
+    // Convert to JSON string
+    FString ResultJson;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultJson);
+    FJsonSerializer::Serialize(AllNodesArray, Writer);
+    
+    UE_LOG(LogTemp, Log, TEXT("Exported %d available nodes from the engine"), AllNodesArray.Num());
+    return ResultJson;
+}
@@ -0,0 +1,293 @@
+#include "GeoBlueprintJsonGraphMetrics.h"
+#include "GeoBlueprintJsonPureNodeAnalysis.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "EdGraphNode_Comment.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_BaseAsyncTask.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_DynamicCast.h"
+#include "K2Node_ForEachElementInEnum.h"
+#include "K2Node_Knot.h"
+
+namespace GeoBlueprintJsonGraphMetrics
+{
+    bool IsExecPin(const UEdGraphPin* Pin)
+    {
+        return Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+    }
+
+    int32 FindRoot(TArray<int32>& Parents, int32 Index)
+    {
+        while (Parents[Index] != Index)
+        {
+            Parents[Index] = Parents[Parents[Index]];
+            Index = Parents[Index];
+        }
+        return Index;
+    }
+}
+
+bool FGeoBlueprintJsonGraphMetricsAnalysis::IsCastNode(const UEdGraphNode* Node)
+{
+    return Node && Node->IsA<UK2Node_DynamicCast>();
+}
+
+bool FGeoBlueprintJsonGraphMetricsAnalysis::IsLoopNode(const UEdGraphNode* Node)
+{
+    return FGeoBlueprintJsonPureNodeAnalysis::IsLoopMacro(Node) || (Node && Node->IsA<UK2Node_ForEachElementInEnum>());
+}
+
+bool FGeoBlueprintJsonGraphMetricsAnalysis::IsLatentNode(const UEdGraphNode* Node)
+{
+    if (const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+    {
+        return CallNode->IsLatentFunction();
+    }
+    return Node && Node->IsA<UK2Node_BaseAsyncTask>();
+}
+
+FGeoBlueprintJsonGraphMetrics FGeoBlueprintJsonGraphMetricsAnalysis::AnalyzeGraph(const UEdGraph* Graph)
+{
+    using namespace GeoBlueprintJsonGraphMetrics;
+
+    FGeoBlueprintJsonGraphMetrics Metrics;
+    if (!Graph)
+    {
+        return Metrics;
+    }
+
+    // Dense indices, so every pass below runs over flat arrays instead of pins and maps
+    TArray<const UEdGraphNode*> Nodes;
+    TMap<const UEdGraphNode*, int32> NodeIndices;
+    Nodes.Reserve(Graph->Nodes.Num());
+    NodeIndices.Reserve(Graph->Nodes.Num());
+    for (const UEdGraphNode* Node : Graph->Nodes)
+    {
+        if (Node && !Node->IsA<UEdGraphNode_Comment>())
+        {
+            NodeIndices.Add(Node, Nodes.Add(Node));
+        }
+    }
+    const int32 NumNodes = Nodes.Num();
+    Metrics.NumNodes = NumNodes;
+
+    // Exec successors of node N are ExecTargets[ExecOffsets[N]] up to ExecTargets[ExecOffsets[N + 1]]
+    TArray<int32> ExecOffsets;
+    TArray<int32> ExecTargets;
+    TArray<int32> ExecInDegree;
+    TArray<bool> HasExecPin;
+    TArray<int32> ChainWeights;
+    ExecOffsets.SetNumUninitialized(NumNodes + 1);
+    ExecInDegree.SetNumZeroed(NumNodes);
+    HasExecPin.SetNumZeroed(NumNodes);
+    ChainWeights.SetNumUninitialized(NumNodes);
+    ExecTargets.Reserve(NumNodes);
+
+    for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+    {
+        const UEdGraphNode* Node = Nodes[NodeIndex];
+        ExecOffsets[NodeIndex] = ExecTargets.Num();
+        ChainWeights[NodeIndex] = Node->IsA<UK2Node_Knot>() ? 0 : 1;
+
+        int32 FanIn = 0;
+        int32 FanOut = 0;
+        for (const UEdGraphPin* Pin : Node->Pins)
+        {
+            if (!Pin)
+            {
+                continue;
+            }
+
+            const bool bExec = IsExecPin(Pin);
+            HasExecPin[NodeIndex] |= bExec;
+            if (Pin->Direction == EGPD_Input)
+            {
+                FanIn += Pin->LinkedTo.Num();
+                continue;
+            }
+
+            FanOut += Pin->LinkedTo.Num();
+            for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+            {
+                const int32* TargetIndex = LinkedPin ? NodeIndices.Find(LinkedPin->GetOwningNodeUnchecked()) : nullptr;
+                if (!TargetIndex)
+                {
+                    continue;
+                }
+                if (bExec)
+                {
+                    ExecTargets.Add(*TargetIndex);
+                    ++ExecInDegree[*TargetIndex];
+                }
+                else
+                {
+                    ++Metrics.NumDataEdges;
+                }
+            }
+        }
+
+        if (FanIn > Metrics.MaxFanIn)
+        {
+            Metrics.MaxFanIn = FanIn;
+            Metrics.MaxFanInNode = Node;
+        }
+        if (FanOut > Metrics.MaxFanOut)
+        {
+            Metrics.MaxFanOut = FanOut;
+            Metrics.MaxFanOutNode = Node;
+        }
+
+        Metrics.NumCasts += IsCastNode(Node) ? 1 : 0;
+        Metrics.NumLoops += IsLoopNode(Node) ? 1 : 0;
+        Metrics.NumLatentNodes += IsLatentNode(Node) ? 1 : 0;
+    }
+    ExecOffsets[NumNodes] = ExecTargets.Num();
+    Metrics.NumExecEdges = ExecTargets.Num();
+
+    // Weakly connected parts of the exec graph for the cyclomatic complexity
+    TArray<int32> Parents;
+    Parents.SetNumUninitialized(NumNodes);
+    for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+    {
+        Parents[NodeIndex] = NodeIndex;
+    }
+    for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+    {
+        for (int32 Edge = ExecOffsets[NodeIndex]; Edge < ExecOffsets[NodeIndex + 1]; ++Edge)
+        {
+            Parents[FindRoot(Parents, ExecTargets[Edge])] = FindRoot(Parents, NodeIndex);
+        }
+    }
+
+    int32 NumParts = 0;
+    int32 NumChainEnds = 0;
+    for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+    {
+        if (HasExecPin[NodeIndex])
+        {
+            ++Metrics.NumExecNodes;
+            Metrics.NumEntryPoints += ExecInDegree[NodeIndex] == 0 ? 1 : 0;
+            NumChainEnds += ExecOffsets[NodeIndex + 1] == ExecOffsets[NodeIndex] ? 1 : 0;
+            NumParts += FindRoot(Parents, NodeIndex) == NodeIndex ? 1 : 0;
+        }
+    }
+
+    // Exec chains end wherever they like instead of meeting at one exit, so every chain end gets an
+    // edge to a virtual exit node per part: (E + Ends) - (N + P) + 2P
+    Metrics.CyclomaticComplexity = Metrics.NumExecEdges + NumChainEnds - Metrics.NumExecNodes + NumParts;
+
+    // Iterative Tarjan, since a recursive walk down a long exec chain would overflow the stack.
+    // Components are completed in reverse topological order, so the chains of every component an
+    // exec edge leaves towards are final by the time the component it leaves from is completed.
+    TArray<int32> Order;
+    TArray<int32> LowLink;
+    TArray<int32> ComponentOf;
+    TArray<bool> OnStack;
+    Order.Init(INDEX_NONE, NumNodes);
+    LowLink.SetNumUninitialized(NumNodes);
+    ComponentOf.Init(INDEX_NONE, NumNodes);
+    OnStack.SetNumZeroed(NumNodes);
+
+    TArray<int32> ComponentChains;
+    TArray<int32> NodeStack;
+    TArray<int32> Members;
+    TArray<TPair<int32, int32>> CallStack;
+    int32 NextOrder = 0;
+
+    auto Visit = [&](int32 NodeIndex)
+    {
+        Order[NodeIndex] = NextOrder;
+        LowLink[NodeIndex] = NextOrder;
+        ++NextOrder;
+        NodeStack.Push(NodeIndex);
+        OnStack[NodeIndex] = true;
+        CallStack.Emplace(NodeIndex, ExecOffsets[NodeIndex]);
+    };
+
+    for (int32 RootIndex = 0; RootIndex < NumNodes; ++RootIndex)
+    {
+        if (!HasExecPin[RootIndex] || Order[RootIndex] != INDEX_NONE)
+        {
+            continue;
+        }
+
+        Visit(RootIndex);
+        while (CallStack.Num() > 0)
+        {
+            const int32 NodeIndex = CallStack.Last().Key;
+            int32& NextEdge = CallStack.Last().Value;
+            if (NextEdge < ExecOffsets[NodeIndex + 1])
+            {
+                const int32 TargetIndex = ExecTargets[NextEdge++];
+                if (Order[TargetIndex] == INDEX_NONE)
+                {
+                    Visit(TargetIndex);
+                }
+                else if (OnStack[TargetIndex])
+                {
+                    LowLink[NodeIndex] = FMath::Min(LowLink[NodeIndex], Order[TargetIndex]);
+                }
+                continue;
+            }
+
+            CallStack.Pop(EAllowShrinking::No);
+            if (CallStack.Num() > 0)
+            {
+                const int32 CallerIndex = CallStack.Last().Key;
+                LowLink[CallerIndex] = FMath::Min(LowLink[CallerIndex], LowLink[NodeIndex]);
+            }
+            if (LowLink[NodeIndex] != Order[NodeIndex])
+            {
+                continue;
+            }
+
+            const int32 Component = ComponentChains.Num();
+            int32 Weight = 0;
+            Members.Reset();
+            int32 Member = INDEX_NONE;
+            do
+            {
+                Member = NodeStack.Pop(EAllowShrinking::No);
+                OnStack[Member] = false;
+                ComponentOf[Member] = Component;
+                Weight += ChainWeights[Member];
+                Members.Add(Member);
+            }
+            while (Member != NodeIndex);
+
+            int32 LongestSuccessor = 0;
+            bool bHasCycle = Members.Num() > 1;
+            for (const int32 MemberIndex : Members)
+            {
+                for (int32 Edge = ExecOffsets[MemberIndex]; Edge < ExecOffsets[MemberIndex + 1]; ++Edge)
+                {
+                    const int32 TargetComponent = ComponentOf[ExecTargets[Edge]];
+                    if (TargetComponent != Component)
+                    {
+                        LongestSuccessor = FMath::Max(LongestSuccessor, ComponentChains[TargetComponent]);
+                    }
+                    else
+                    {
+                        bHasCycle = true;
+                    }
+                }
+            }
+            ComponentChains.Add(Weight + LongestSuccessor);
+
+            if (bHasCycle)
+            {
+                ++Metrics.NumExecCycles;
+                Metrics.LargestExecCycle = FMath::Max(Metrics.LargestExecCycle, Members.Num());
+            }
+        }
+    }
+
+    Metrics.NumStronglyConnectedComponents = ComponentChains.Num();
+    for (const int32 Chain : ComponentChains)
+    {
+        Metrics.LongestExecChain = FMath::Max(Metrics.LongestExecChain, Chain);
+    }
+    return Metrics;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UEdGraph;
+class UEdGraphNode;
+
+/** Structural metrics of one graph */
+struct FGeoBlueprintJsonGraphMetrics
+{
+    /** Nodes other than comments */
+    int32 NumNodes = 0;
+
+    /** Nodes with at least one exec pin */
+    int32 NumExecNodes = 0;
+
+    int32 NumExecEdges = 0;
+    int32 NumDataEdges = 0;
+
+    /** Exec nodes nothing executes into: events, function entries and orphaned chains */
+    int32 NumEntryPoints = 0;
+
+    /**
+     * McCabe's E - N + 2P over the exec graph, where P counts its weakly connected parts and every
+     * chain end is joined to one exit per part. A Branch adds one, as does each extra Sequence output.
+     */
+    int32 CyclomaticComplexity = 0;
+
+    /** Most links on the input pins and on the output pins of a single node */
+    int32 MaxFanIn = 0;
+    int32 MaxFanOut = 0;
+    const UEdGraphNode* MaxFanInNode = nullptr;
+    const UEdGraphNode* MaxFanOutNode = nullptr;
+
+    /** Most nodes on one exec path, with each exec cycle counted once. Reroute nodes don't count. */
+    int32 LongestExecChain = 0;
+
+    int32 NumStronglyConnectedComponents = 0;
+
+    /** Strongly connected components of the exec graph that contain a cycle */
+    int32 NumExecCycles = 0;
+    int32 LargestExecCycle = 0;
+
+    int32 NumCasts = 0;
+    int32 NumLoops = 0;
+    int32 NumLatentNodes = 0;
+};
+
+/**
+ * Single pass over a graph's nodes and links. The exec graph is flattened into index arrays once,
+ * then components, strongly connected components and the longest chain all come from one
+ * union-find and one iterative Tarjan walk, so the cost is linear in nodes plus links.
+ */
+class FGeoBlueprintJsonGraphMetricsAnalysis
+{
+public:
+    static FGeoBlueprintJsonGraphMetrics AnalyzeGraph(const UEdGraph* Graph);
+
+    static bool IsCastNode(const UEdGraphNode* Node);
+    static bool IsLoopNode(const UEdGraphNode* Node);
+    static bool IsLatentNode(const UEdGraphNode* Node);
+};
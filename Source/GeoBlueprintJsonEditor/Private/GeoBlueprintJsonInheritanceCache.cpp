@@ -0,0 +1,101 @@
+#include "GeoBlueprintJsonInheritanceCache.h"
+#include "Engine/Blueprint.h"
+#include "Misc/PackageName.h"
+
+namespace GeoBlueprintJsonInheritanceCache
+{
+    static constexpr int32 DepthUnknown = -1;
+    static constexpr int32 DepthInProgress = -2;
+}
+
+void FGeoBlueprintJsonInheritanceCache::SortParentFirst(TArray<FAssetData>& Assets)
+{
+    using namespace GeoBlueprintJsonInheritanceCache;
+
+    TMap<FName, int32> IndexByPackage;
+    IndexByPackage.Reserve(Assets.Num());
+    for (int32 Index = 0; Index < Assets.Num(); ++Index)
+    {
+        IndexByPackage.Add(Assets[Index].PackageName, Index);
+    }
+
+    // The tag holds an export text path such as /Script/Engine.BlueprintGeneratedClass'/Game/BP_Base.BP_Base_C'
+    TArray<int32> ParentIndices;
+    ParentIndices.Init(INDEX_NONE, Assets.Num());
+    for (int32 Index = 0; Index < Assets.Num(); ++Index)
+    {
+        FString ParentClassPath;
+        if (!Assets[Index].GetTagValue(FBlueprintTags::ParentClassPath, ParentClassPath))
+        {
+            continue;
+        }
+
+        const FString ParentObjectPath = FPackageName::ExportTextPathToObjectPath(ParentClassPath);
+        const int32* ParentIndex = IndexByPackage.Find(FName(*FPackageName::ObjectPathToPackageName(ParentObjectPath)));
+        if (ParentIndex && *ParentIndex != Index)
+        {
+            ParentIndices[Index] = *ParentIndex;
+        }
+    }
+
+    // Depth below the nearest listed root. Each asset is visited once; a parent cycle left behind by
+    // broken assets is cut where it closes.
+    TArray<int32> Depths;
+    Depths.Init(DepthUnknown, Assets.Num());
+    TArray<int32> Chain;
+    for (int32 Index = 0; Index < Assets.Num(); ++Index)
+    {
+        Chain.Reset();
+        int32 Ancestor = Index;
+        while (Ancestor != INDEX_NONE && Depths[Ancestor] == DepthUnknown)
+        {
+            Depths[Ancestor] = DepthInProgress;
+            Chain.Add(Ancestor);
+            Ancestor = ParentIndices[Ancestor];
+        }
+
+        int32 Depth = Ancestor != INDEX_NONE && Depths[Ancestor] >= 0 ? Depths[Ancestor] : -1;
+        for (int32 ChainIndex = Chain.Num() - 1; ChainIndex >= 0; --ChainIndex)
+        {
+            Depths[Chain[ChainIndex]] = ++Depth;
+        }
+    }
+
+    // Stable, so assets of one depth keep the package name order they were gathered in
+    TArray<int32> Order;
+    Order.Reserve(Assets.Num());
+    for (int32 Index = 0; Index < Assets.Num(); ++Index)
+    {
+        Order.Add(Index);
+    }
+    Order.StableSort([&Depths](int32 A, int32 B)
+    {
+        return Depths[A] < Depths[B];
+    });
+
+    TArray<FAssetData> SortedAssets;
+    SortedAssets.Reserve(Assets.Num());
+    for (const int32 Index : Order)
+    {
+        SortedAssets.Add(MoveTemp(Assets[Index]));
+    }
+    Assets = MoveTemp(SortedAssets);
+}
+
+const FGeoBlueprintJsonInheritanceCache::FEntry* FGeoBlueprintJsonInheritanceCache::FindParent(const UBlueprint* Blueprint) const
+{
+    return Blueprint && Blueprint->ParentClass ? Entries.Find(Blueprint->ParentClass->GetClassPathName()) : nullptr;
+}
+
+void FGeoBlueprintJsonInheritanceCache::Add(const UBlueprint* Blueprint, FEntry&& Entry)
+{
+    if (Blueprint && Blueprint->GeneratedClass)
+    {
+        Entries.Add(Blueprint->GeneratedClass->GetClassPathName(), MoveTemp(Entry));
+    }
+}
+
+void FGeoBlueprintJsonInheritanceCache::Reset()
+{
+    Entries.Reset();
+}
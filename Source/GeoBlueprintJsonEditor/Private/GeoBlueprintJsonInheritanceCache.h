@@ -0,0 +1,41 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "UObject/TopLevelAssetPath.h"
+
+class UBlueprint;
+
+/**
+ * What a parent-first export remembers about each Blueprint it has exported, so a child can point at
+ * its parent's record instead of repeating it. Entries hold no UObject references and survive the
+ * garbage collections of a bulk export. Game thread only.
+ */
+class FGeoBlueprintJsonInheritanceCache
+{
+public:
+    struct FEntry
+    {
+        /** Object path of the exported Blueprint asset */
+        FString AssetPath;
+
+        /** Estimated cost of every component an instance gets, inherited ones included, by name */
+        TMap<FName, double> ComponentCosts;
+    };
+
+    /**
+     * Stable-sorts assets so every Blueprint comes after all of its ancestors in the list. Parents are
+     * read from the Asset Registry, so nothing is loaded to order the export.
+     */
+    static void SortParentFirst(TArray<FAssetData>& Assets);
+
+    /** The entry of the Blueprint's parent Blueprint, or null when the parent hasn't been exported */
+    const FEntry* FindParent(const UBlueprint* Blueprint) const;
+
+    void Add(const UBlueprint* Blueprint, FEntry&& Entry);
+    void Reset();
+
+private:
+    /** Keyed by generated class, which is what a child names as its parent class */
+    TMap<FTopLevelAssetPath, FEntry> Entries;
+};
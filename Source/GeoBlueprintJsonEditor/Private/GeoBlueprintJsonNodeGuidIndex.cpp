@@ -0,0 +1,133 @@
+#include "GeoBlueprintJsonNodeGuidIndex.h"
+#include "GeoBlueprintJsonEditorInvalidation.h"
+#include "GeoBlueprintJsonGraphExporter.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "Engine/Blueprint.h"
+
+FGeoBlueprintJsonNodeGuidIndex& FGeoBlueprintJsonNodeGuidIndex::Get()
+{
+    static FGeoBlueprintJsonNodeGuidIndex Index;
+    return Index;
+}
+
+void FGeoBlueprintJsonNodeGuidIndex::Register()
+{
+    if (ObjectChangedHandle.IsValid())
+    {
+        return;
+    }
+
+    FGeoBlueprintJsonEditorInvalidation& Invalidation = FGeoBlueprintJsonEditorInvalidation::Get();
+    ObjectChangedHandle = Invalidation.OnObjectChanged().AddRaw(this, &FGeoBlueprintJsonNodeGuidIndex::OnObjectChanged);
+    BlueprintCompiledHandle = Invalidation.OnBlueprintCompiled().AddRaw(this, &FGeoBlueprintJsonNodeGuidIndex::Reset);
+    PostGarbageCollectHandle = Invalidation.OnPostGarbageCollect().AddRaw(this, &FGeoBlueprintJsonNodeGuidIndex::OnPostGarbageCollect);
+}
+
+void FGeoBlueprintJsonNodeGuidIndex::Unregister()
+{
+    FGeoBlueprintJsonEditorInvalidation& Invalidation = FGeoBlueprintJsonEditorInvalidation::Get();
+    Invalidation.OnObjectChanged().Remove(ObjectChangedHandle);
+    Invalidation.OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+    Invalidation.OnPostGarbageCollect().Remove(PostGarbageCollectHandle);
+
+    ObjectChangedHandle.Reset();
+    BlueprintCompiledHandle.Reset();
+    PostGarbageCollectHandle.Reset();
+    Indices.Empty();
+}
+
+UEdGraphNode* FGeoBlueprintJsonNodeGuidIndex::FindNode(UBlueprint* Blueprint, const FGuid& NodeGuid)
+{
+    check(IsInGameThread());
+
+    if (!Blueprint || !NodeGuid.IsValid())
+    {
+        return nullptr;
+    }
+
+    // Without the invalidation delegates an index could go stale, so nothing is kept
+    if (!ObjectChangedHandle.IsValid() || !FGeoBlueprintJsonEditorInvalidation::Get().IsRegistered())
+    {
+        return ScanForNode(Blueprint, NodeGuid);
+    }
+
+    const TObjectKey<UBlueprint> Key(Blueprint);
+    FNodesByGuid* Nodes = Indices.Find(Key);
+    const bool bBuiltNow = !Nodes;
+    if (!Nodes)
+    {
+        Nodes = &Indices.Add(Key);
+        BuildIndex(Blueprint, *Nodes);
+    }
+
+    const TObjectKey<UEdGraphNode>* NodeKey = Nodes->Find(NodeGuid);
+    UEdGraphNode* Node = NodeKey ? NodeKey->ResolveObjectPtr() : nullptr;
+    if (Node && Node->NodeGuid == NodeGuid)
+    {
+        return Node;
+    }
+
+    if (!bBuiltNow)
+    {
+        Nodes->Reset();
+        BuildIndex(Blueprint, *Nodes);
+        NodeKey = Nodes->Find(NodeGuid);
+        Node = NodeKey ? NodeKey->ResolveObjectPtr() : nullptr;
+    }
+    return Node;
+}
+
+void FGeoBlueprintJsonNodeGuidIndex::BuildIndex(UBlueprint* Blueprint, FNodesByGuid& OutNodes)
+{
+    // The first node wins when GUIDs collide, matching the order of a scan
+    FGeoBlueprintJsonGraphExporter::ForEachExportedGraph(Blueprint, [&OutNodes](UEdGraph* Graph, const TCHAR* GraphType)
+    {
+        for (UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (Node && !OutNodes.Contains(Node->NodeGuid))
+            {
+                OutNodes.Add(Node->NodeGuid, Node);
+            }
+        }
+    });
+}
+
+UEdGraphNode* FGeoBlueprintJsonNodeGuidIndex::ScanForNode(UBlueprint* Blueprint, const FGuid& NodeGuid)
+{
+    UEdGraphNode* FoundNode = nullptr;
+    FGeoBlueprintJsonGraphExporter::ForEachExportedGraph(Blueprint, [&FoundNode, &NodeGuid](UEdGraph* Graph, const TCHAR* GraphType)
+    {
+        for (int32 Index = 0; !FoundNode && Index < Graph->Nodes.Num(); ++Index)
+        {
+            UEdGraphNode* Node = Graph->Nodes[Index];
+            FoundNode = Node && Node->NodeGuid == NodeGuid ? Node : nullptr;
+        }
+    });
+    return FoundNode;
+}
+
+void FGeoBlueprintJsonNodeGuidIndex::Invalidate(const UBlueprint* Blueprint)
+{
+    Indices.Remove(TObjectKey<UBlueprint>(Blueprint));
+}
+
+void FGeoBlueprintJsonNodeGuidIndex::Reset()
+{
+    Indices.Reset();
+}
+
+void FGeoBlueprintJsonNodeGuidIndex::OnObjectChanged(UObject* Object)
+{
+    // Adding or removing a node modifies its graph, and adding or removing a graph modifies the Blueprint
+    if (Indices.Num() > 0 && (Object->IsA<UEdGraphNode>() || Object->IsA<UEdGraph>() || Object->IsA<UBlueprint>()))
+    {
+        const UBlueprint* Blueprint = Cast<UBlueprint>(Object);
+        Invalidate(Blueprint ? Blueprint : Object->GetTypedOuter<UBlueprint>());
+    }
+}
+
+void FGeoBlueprintJsonNodeGuidIndex::OnPostGarbageCollect()
+{
+    FGeoBlueprintJsonEditorInvalidation::RemoveCollectedKeys(Indices);
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class UBlueprint;
+class UEdGraphNode;
+
+/**
+ * Node GUID to node lookup for the graphs FGeoBlueprintJsonGraphExporter exports, built per Blueprint
+ * on its first lookup. Neighborhood exports look their start node up by GUID, and without the index
+ * each one scanned every node of the Blueprint before visiting only a few of them.
+ *
+ * A Blueprint's index is dropped when the Blueprint, one of its graphs or one of its nodes is modified
+ * or edited, and everything is dropped after a Blueprint compile, which can rebuild generated graphs.
+ * A GUID that isn't found rebuilds the index once before giving up, so a change that slipped past the
+ * delegates costs a scan rather than a wrong answer. Game thread only.
+ */
+class FGeoBlueprintJsonNodeGuidIndex
+{
+public:
+    static FGeoBlueprintJsonNodeGuidIndex& Get();
+
+    /** Subscribes to FGeoBlueprintJsonEditorInvalidation; called by the editor module */
+    void Register();
+    void Unregister();
+
+    UEdGraphNode* FindNode(UBlueprint* Blueprint, const FGuid& NodeGuid);
+
+    void Invalidate(const UBlueprint* Blueprint);
+    void Reset();
+    int32 Num() const { return Indices.Num(); }
+
+private:
+    using FNodesByGuid = TMap<FGuid, TObjectKey<UEdGraphNode>>;
+
+    static void BuildIndex(UBlueprint* Blueprint, FNodesByGuid& OutNodes);
+    static UEdGraphNode* ScanForNode(UBlueprint* Blueprint, const FGuid& NodeGuid);
+
+    void OnObjectChanged(UObject* Object);
+    void OnPostGarbageCollect();
+
+    TMap<TObjectKey<UBlueprint>, FNodesByGuid> Indices;
+
+    FDelegateHandle ObjectChangedHandle;
+    FDelegateHandle BlueprintCompiledHandle;
+    FDelegateHandle PostGarbageCollectHandle;
+};
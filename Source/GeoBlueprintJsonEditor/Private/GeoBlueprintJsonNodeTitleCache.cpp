@@ -0,0 +1,89 @@
+#include "GeoBlueprintJsonNodeTitleCache.h"
+#include "GeoBlueprintJsonEditorInvalidation.h"
+#include "EdGraph/EdGraphNode.h"
+
+FGeoBlueprintJsonNodeTitleCache& FGeoBlueprintJsonNodeTitleCache::Get()
+{
+    static FGeoBlueprintJsonNodeTitleCache Cache;
+    return Cache;
+}
+
+void FGeoBlueprintJsonNodeTitleCache::Register()
+{
+    if (ObjectChangedHandle.IsValid())
+    {
+        return;
+    }
+
+    FGeoBlueprintJsonEditorInvalidation& Invalidation = FGeoBlueprintJsonEditorInvalidation::Get();
+    ObjectChangedHandle = Invalidation.OnObjectChanged().AddRaw(this, &FGeoBlueprintJsonNodeTitleCache::OnObjectChanged);
+    BlueprintCompiledHandle = Invalidation.OnBlueprintCompiled().AddRaw(this, &FGeoBlueprintJsonNodeTitleCache::Reset);
+    CultureChangedHandle = Invalidation.OnCultureChanged().AddRaw(this, &FGeoBlueprintJsonNodeTitleCache::Reset);
+    PostGarbageCollectHandle = Invalidation.OnPostGarbageCollect().AddRaw(this, &FGeoBlueprintJsonNodeTitleCache::OnPostGarbageCollect);
+}
+
+void FGeoBlueprintJsonNodeTitleCache::Unregister()
+{
+    FGeoBlueprintJsonEditorInvalidation& Invalidation = FGeoBlueprintJsonEditorInvalidation::Get();
+    Invalidation.OnObjectChanged().Remove(ObjectChangedHandle);
+    Invalidation.OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+    Invalidation.OnCultureChanged().Remove(CultureChangedHandle);
+    Invalidation.OnPostGarbageCollect().Remove(PostGarbageCollectHandle);
+
+    ObjectChangedHandle.Reset();
+    BlueprintCompiledHandle.Reset();
+    CultureChangedHandle.Reset();
+    PostGarbageCollectHandle.Reset();
+    Titles.Empty();
+}
+
+const FString& FGeoBlueprintJsonNodeTitleCache::GetTitle(const UEdGraphNode* Node)
+{
+    check(IsInGameThread());
+
+    if (!Node)
+    {
+        UncachedTitle.Reset();
+        return UncachedTitle;
+    }
+
+    // Without the invalidation delegates a cached title could go stale, so nothing is kept
+    if (!ObjectChangedHandle.IsValid() || !FGeoBlueprintJsonEditorInvalidation::Get().IsRegistered())
+    {
+        UncachedTitle = Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString();
+        return UncachedTitle;
+    }
+
+    const TObjectKey<UEdGraphNode> Key(Node);
+    if (const FString* Title = Titles.Find(Key))
+    {
+        return *Title;
+    }
+    return Titles.Add(Key, Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString());
+}
+
+void FGeoBlueprintJsonNodeTitleCache::Invalidate(const UEdGraphNode* Node)
+{
+    Titles.Remove(TObjectKey<UEdGraphNode>(Node));
+}
+
+void FGeoBlueprintJsonNodeTitleCache::Reset()
+{
+    Titles.Reset();
+}
+
+void FGeoBlueprintJsonNodeTitleCache::OnObjectChanged(UObject* Object)
+{
+    if (Titles.Num() > 0)
+    {
+        if (const UEdGraphNode* Node = Cast<UEdGraphNode>(Object))
+        {
+            Invalidate(Node);
+        }
+    }
+}
+
+void FGeoBlueprintJsonNodeTitleCache::OnPostGarbageCollect()
+{
+    FGeoBlueprintJsonEditorInvalidation::RemoveCollectedKeys(Titles);
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class UEdGraphNode;
+
+/**
+ * Full node titles shared by every export path. Building a title formats localized text, which is
+ * expensive for call-function and macro nodes, and exports ask for it once per node and again for
+ * every link into the node. With the cache each distinct node is titled once until it changes.
+ *
+ * An entry is dropped when its node is modified or edited. Everything is dropped when the culture
+ * changes and after a Blueprint compile, since titles also depend on the functions and macros a
+ * node refers to. Game thread only, like GetNodeTitle itself.
+ */
+class FGeoBlueprintJsonNodeTitleCache
+{
+public:
+    static FGeoBlueprintJsonNodeTitleCache& Get();
+
+    /** Subscribes to FGeoBlueprintJsonEditorInvalidation; called by the editor module */
+    void Register();
+    void Unregister();
+
+    /** The node's FullTitle. The reference stays valid until the next call. */
+    const FString& GetTitle(const UEdGraphNode* Node);
+
+    void Invalidate(const UEdGraphNode* Node);
+    void Reset();
+    int32 Num() const { return Titles.Num(); }
+
+private:
+    void OnObjectChanged(UObject* Object);
+    void OnPostGarbageCollect();
+
+    TMap<TObjectKey<UEdGraphNode>, FString> Titles;
+    FString UncachedTitle;
+
+    FDelegateHandle ObjectChangedHandle;
+    FDelegateHandle BlueprintCompiledHandle;
+    FDelegateHandle CultureChangedHandle;
+    FDelegateHandle PostGarbageCollectHandle;
+};
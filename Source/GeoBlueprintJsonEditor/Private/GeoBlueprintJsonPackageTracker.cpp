@@ -0,0 +1,94 @@
+#include "GeoBlueprintJsonPackageTracker.h"
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectHash.h"
+
+FGeoBlueprintJsonPackageTracker::~FGeoBlueprintJsonPackageTracker()
+{
+    StopRecording();
+}
+
+UObject* FGeoBlueprintJsonPackageTracker::LoadAsset(const FAssetData& AssetData)
+{
+    const bool bWasRecording = EndLoadPackageHandle.IsValid();
+    StartRecording();
+    UObject* Asset = AssetData.GetAsset();
+    if (!bWasRecording)
+    {
+        StopRecording(AssetData.PackageName);
+    }
+    return Asset;
+}
+
+void FGeoBlueprintJsonPackageTracker::StartRecording()
+{
+    if (!EndLoadPackageHandle.IsValid())
+    {
+        EndLoadPackageHandle = FCoreUObjectDelegates::OnEndLoadPackage.AddRaw(this, &FGeoBlueprintJsonPackageTracker::OnEndLoadPackage);
+    }
+}
+
+void FGeoBlueprintJsonPackageTracker::StopRecording(FName RootPackageName)
+{
+    FCoreUObjectDelegates::OnEndLoadPackage.Remove(EndLoadPackageHandle);
+    EndLoadPackageHandle.Reset();
+
+    // Loads someone else started can finish inside the window too. Walking hard dependencies only
+    // through recorded packages keeps what this load pulled in: anything it imports that was resident
+    // before had its own imports loaded already.
+    if (!RootPackageName.IsNone() && RecordedPackageNames.Contains(RootPackageName))
+    {
+        IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+        TArray<FName> PendingPackageNames = { RootPackageName };
+        RecordedPackageNames.Remove(RootPackageName);
+        PackageNames.Add(RootPackageName);
+
+        TArray<FName> Dependencies;
+        while (PendingPackageNames.Num() > 0)
+        {
+            Dependencies.Reset();
+            AssetRegistry.GetDependencies(PendingPackageNames.Pop(EAllowShrinking::No), Dependencies, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+            for (const FName Dependency : Dependencies)
+            {
+                if (RecordedPackageNames.Remove(Dependency) > 0)
+                {
+                    PackageNames.Add(Dependency);
+                    PendingPackageNames.Add(Dependency);
+                }
+            }
+        }
+    }
+    RecordedPackageNames.Reset();
+}
+
+void FGeoBlueprintJsonPackageTracker::ReleasePackages()
+{
+    for (const FName PackageName : PackageNames)
+    {
+        UPackage* Package = FindObjectFast<UPackage>(nullptr, PackageName);
+        if (!Package || Package->IsDirty() || Package->HasAnyPackageFlags(PKG_CompiledIn))
+        {
+            continue;
+        }
+
+        ForEachObjectWithPackage(Package, [](UObject* Object)
+        {
+            Object->ClearFlags(RF_Standalone);
+            return true;
+        });
+    }
+    PackageNames.Reset();
+}
+
+void FGeoBlueprintJsonPackageTracker::OnEndLoadPackage(const FEndLoadPackageContext& Context)
+{
+    for (const UPackage* Package : Context.LoadedPackages)
+    {
+        if (Package)
+        {
+            RecordedPackageNames.Add(Package->GetFName());
+        }
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Delegates/IDelegateInstance.h"
+
+struct FAssetData;
+struct FEndLoadPackageContext;
+
+/**
+ * Remembers the packages an export loaded itself, so they can be handed back to the garbage collector
+ * without touching packages that were already resident or that someone else loaded in the meantime.
+ * Packages that finish loading while recording are collected, and when recording stops only the
+ * requested package and the recorded packages it imports, directly or through each other, are kept.
+ */
+class FGeoBlueprintJsonPackageTracker
+{
+public:
+    FGeoBlueprintJsonPackageTracker() = default;
+    ~FGeoBlueprintJsonPackageTracker();
+
+    FGeoBlueprintJsonPackageTracker(const FGeoBlueprintJsonPackageTracker&) = delete;
+    FGeoBlueprintJsonPackageTracker& operator=(const FGeoBlueprintJsonPackageTracker&) = delete;
+
+    /** Loads an asset synchronously, recording what the load pulls in */
+    UObject* LoadAsset(const FAssetData& AssetData);
+
+    /**
+     * For asynchronous loads. Stopping with the requested package keeps what was recorded for it;
+     * stopping without one, as when a load is abandoned, keeps nothing from the window.
+     */
+    void StartRecording();
+    void StopRecording(FName RootPackageName = NAME_None);
+
+    /**
+     * Assets are RF_Standalone, which keeps them alive through an editor GC. Dropping the flag on the
+     * recorded packages without unsaved changes lets the next collection reclaim them. The recorded
+     * set is cleared.
+     */
+    void ReleasePackages();
+
+    int32 Num() const { return PackageNames.Num(); }
+
+private:
+    void OnEndLoadPackage(const FEndLoadPackageContext& Context);
+
+    TSet<FName> PackageNames;
+    TSet<FName> RecordedPackageNames;
+    FDelegateHandle EndLoadPackageHandle;
+};
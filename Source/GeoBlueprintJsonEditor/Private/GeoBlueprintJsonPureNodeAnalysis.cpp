@@ -0,0 +1,237 @@
+#include "GeoBlueprintJsonPureNodeAnalysis.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Knot.h"
+#include "K2Node_MacroInstance.h"
+#include "K2Node_Self.h"
+#include "K2Node_VariableGet.h"
+
+namespace GeoBlueprintJsonPureNodeAnalysis
+{
+    bool IsExecPin(const UEdGraphPin* Pin)
+    {
+        return Pin && Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+    }
+
+    bool IsPureNode(const UEdGraphNode* Node)
+    {
+        const UK2Node* K2Node = Cast<UK2Node>(Node);
+        return K2Node && K2Node->IsNodePure();
+    }
+
+    bool IsLoopBodyPin(const UEdGraphPin* Pin)
+    {
+        return Pin->PinName.ToString().Replace(TEXT(" "), TEXT("")).Equals(TEXT("LoopBody"), ESearchCase::IgnoreCase);
+    }
+}
+
+bool FGeoBlueprintJsonPureNodeAnalysis::IsLoopMacro(const UEdGraphNode* Node)
+{
+    const UK2Node_MacroInstance* MacroNode = Cast<UK2Node_MacroInstance>(Node);
+    const UEdGraph* MacroGraph = MacroNode ? MacroNode->GetMacroGraph() : nullptr;
+    if (!MacroGraph)
+    {
+        return false;
+    }
+
+    static const FName LoopMacroNames[] =
+    {
+        TEXT("ForEachLoop"),
+        TEXT("ForEachLoopWithBreak"),
+        TEXT("ReverseForEachLoop"),
+        TEXT("ForLoop"),
+        TEXT("ForLoopWithBreak"),
+        TEXT("WhileLoop")
+    };
+
+    const FName MacroName = MacroGraph->GetFName();
+    for (const FName LoopMacroName : LoopMacroNames)
+    {
+        if (MacroName == LoopMacroName)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+TMap<const UEdGraphNode*, double> FGeoBlueprintJsonPureNodeAnalysis::ComputeExecMultipliers(const UEdGraph* Graph, double LoopIterations)
+{
+    using namespace GeoBlueprintJsonPureNodeAnalysis;
+
+    // Manual exec cycles through a loop body would otherwise grow forever
+    const double MaxMultiplier = LoopIterations * LoopIterations * LoopIterations;
+
+    TMap<const UEdGraphNode*, double> Multipliers;
+    TArray<const UEdGraphNode*> Worklist;
+
+    // Chain roots are impure nodes nothing executes into: events, function entries and orphaned chains
+    for (const UEdGraphNode* Node : Graph->Nodes)
+    {
+        if (!Node || IsPureNode(Node))
+        {
+            continue;
+        }
+
+        bool bHasExecPin = false;
+        bool bHasLinkedExecInput = false;
+        for (const UEdGraphPin* Pin : Node->Pins)
+        {
+            if (IsExecPin(Pin))
+            {
+                bHasExecPin = true;
+                bHasLinkedExecInput |= Pin->Direction == EGPD_Input && Pin->LinkedTo.Num() > 0;
+            }
+        }
+
+        if (bHasExecPin && !bHasLinkedExecInput)
+        {
+            Multipliers.Add(Node, 1.0);
+            Worklist.Add(Node);
+        }
+    }
+
+    while (Worklist.Num() > 0)
+    {
+        const UEdGraphNode* Node = Worklist.Pop(EAllowShrinking::No);
+        const double Multiplier = Multipliers.FindChecked(Node);
+        const bool bIsLoop = IsLoopMacro(Node);
+
+        for (const UEdGraphPin* Pin : Node->Pins)
+        {
+            if (Pin->Direction != EGPD_Output || !IsExecPin(Pin))
+            {
+                continue;
+            }
+
+            const double ChildMultiplier = FMath::Min(MaxMultiplier, bIsLoop && IsLoopBodyPin(Pin) ? Multiplier * LoopIterations : Multiplier);
+            for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+            {
+                const UEdGraphNode* Child = LinkedPin ? LinkedPin->GetOwningNode() : nullptr;
+                if (!Child)
+                {
+                    continue;
+                }
+
+                // A node reachable along several paths is charged for the hottest one
+                double& ChildValue = Multipliers.FindOrAdd(Child, 0.0);
+                if (ChildMultiplier > ChildValue)
+                {
+                    ChildValue = ChildMultiplier;
+                    Worklist.Add(Child);
+                }
+            }
+        }
+    }
+
+    // Impure nodes only reachable through an exec cycle still run at least once
+    for (const UEdGraphNode* Node : Graph->Nodes)
+    {
+        if (Node && !IsPureNode(Node) && !Multipliers.Contains(Node))
+        {
+            Multipliers.Add(Node, 1.0);
+        }
+    }
+    return Multipliers;
+}
+
+double FGeoBlueprintJsonPureNodeAnalysis::GetEvaluationWeight(const UEdGraphNode* Node)
+{
+    if (Node->IsA<UK2Node_Knot>())
+    {
+        return 0.0;
+    }
+    if (Node->IsA<UK2Node_VariableGet>() || Node->IsA<UK2Node_Self>())
+    {
+        return 0.1;
+    }
+    if (Node->IsA<UK2Node_CallFunction>() || Node->IsA<UK2Node_MacroInstance>())
+    {
+        return 1.0;
+    }
+    return 0.5;
+}
+
+TArray<FGeoBlueprintJsonPureNodeCost> FGeoBlueprintJsonPureNodeAnalysis::AnalyzeGraph(const UEdGraph* Graph, int32 AssumedLoopIterations)
+{
+    using namespace GeoBlueprintJsonPureNodeAnalysis;
+
+    TArray<FGeoBlueprintJsonPureNodeCost> Results;
+    if (!Graph)
+    {
+        return Results;
+    }
+
+    const double LoopIterations = FMath::Max(1, AssumedLoopIterations);
+    const TMap<const UEdGraphNode*, double> Multipliers = ComputeExecMultipliers(Graph, LoopIterations);
+
+    TMap<const UEdGraphNode*, FGeoBlueprintJsonPureNodeCost> Costs;
+    TSet<const UEdGraphNode*> Visited;
+    TArray<const UEdGraphNode*> Stack;
+
+    for (const TPair<const UEdGraphNode*, double>& Consumer : Multipliers)
+    {
+        // Loop macros read their data inputs again on every iteration and once more to exit
+        const double InputFactor = IsLoopMacro(Consumer.Key) ? LoopIterations + 1.0 : 1.0;
+        const double Evaluations = Consumer.Value * InputFactor;
+
+        // Walk the pure subtree feeding this consumer; each pure node is evaluated once per consumer execution
+        Visited.Reset();
+        Stack.Reset();
+        Stack.Add(Consumer.Key);
+        while (Stack.Num() > 0)
+        {
+            const UEdGraphNode* Node = Stack.Pop(EAllowShrinking::No);
+            for (const UEdGraphPin* Pin : Node->Pins)
+            {
+                if (Pin->Direction != EGPD_Input || IsExecPin(Pin))
+                {
+                    continue;
+                }
+
+                for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+                {
+                    const UEdGraphNode* Source = LinkedPin ? LinkedPin->GetOwningNode() : nullptr;
+                    if (Source && IsPureNode(Source) && !Visited.Contains(Source))
+                    {
+                        Visited.Add(Source);
+                        Stack.Add(Source);
+                    }
+                }
+            }
+        }
+
+        for (const UEdGraphNode* PureNode : Visited)
+        {
+            FGeoBlueprintJsonPureNodeCost& Cost = Costs.FindOrAdd(PureNode);
+            Cost.Node = PureNode;
+            Cost.ImpureConsumers++;
+            Cost.Evaluations += Evaluations;
+            Cost.bInLoop |= Evaluations > 1.0;
+        }
+    }
+
+    for (TPair<const UEdGraphNode*, FGeoBlueprintJsonPureNodeCost>& Pair : Costs)
+    {
+        FGeoBlueprintJsonPureNodeCost& Cost = Pair.Value;
+        Cost.EstimatedCost = Cost.Evaluations * GetEvaluationWeight(Cost.Node);
+        if (Cost.Evaluations > 1.0 && Cost.EstimatedCost > 0.0)
+        {
+            Results.Add(Cost);
+        }
+    }
+
+    Results.Sort([](const FGeoBlueprintJsonPureNodeCost& A, const FGeoBlueprintJsonPureNodeCost& B)
+    {
+        if (A.EstimatedCost != B.EstimatedCost)
+        {
+            return A.EstimatedCost > B.EstimatedCost;
+        }
+        return A.Node->NodeGuid < B.Node->NodeGuid;
+    });
+    return Results;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UEdGraph;
+class UEdGraphNode;
+
+/** Estimated re-evaluation cost of one pure node */
+struct FGeoBlueprintJsonPureNodeCost
+{
+    const UEdGraphNode* Node = nullptr;
+
+    /** Distinct impure nodes that pull this node's value, directly or through other pure nodes */
+    int32 ImpureConsumers = 0;
+
+    /** Estimated evaluations per execution of the owning exec chain */
+    double Evaluations = 0.0;
+
+    /** Evaluations weighted by how expensive the node is to run */
+    double EstimatedCost = 0.0;
+
+    bool bInLoop = false;
+};
+
+/**
+ * Data-flow pass estimating how often pure nodes run. The Blueprint VM evaluates a pure node again
+ * for every impure node that consumes it, and a loop macro re-reads its inputs on every iteration,
+ * so each pure node is charged once per consumer execution, scaled by the loop nesting of that consumer.
+ */
+class FGeoBlueprintJsonPureNodeAnalysis
+{
+public:
+    /** Returns pure nodes evaluated more than once per execution, most expensive first */
+    static TArray<FGeoBlueprintJsonPureNodeCost> AnalyzeGraph(const UEdGraph* Graph, int32 AssumedLoopIterations);
+
+    static bool IsLoopMacro(const UEdGraphNode* Node);
+
+private:
+    static TMap<const UEdGraphNode*, double> ComputeExecMultipliers(const UEdGraph* Graph, double LoopIterations);
+    static double GetEvaluationWeight(const UEdGraphNode* Node);
+};
@@ -0,0 +1,176 @@
+#include "GeoBlueprintJsonReferenceAnalysis.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphPin.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_DynamicCast.h"
+#include "K2Node_SpawnActor.h"
+#include "K2Node_SpawnActorFromClass.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/UnrealType.h"
+
+namespace GeoBlueprintJsonReferenceAnalysis
+{
+    static const FGeoBlueprintJsonLoadClosure& FindOrComputeClosure(FGeoBlueprintJsonLoadClosureCache& Closures, FName PackageName)
+    {
+        if (const FGeoBlueprintJsonLoadClosure* Closure = Closures.Find(PackageName))
+        {
+            return *Closure;
+        }
+        return Closures.Add(PackageName, FGeoBlueprintJsonReferenceAnalysis::ComputeLoadClosure(PackageName));
+    }
+
+    struct FReferenceCollector
+    {
+        FGeoBlueprintJsonReferenceReport& Report;
+        FGeoBlueprintJsonLoadClosureCache& Closures;
+
+        void Add(const TCHAR* Kind, const UObject* Target, const UEdGraphNode* Node, FName VariableName = NAME_None)
+        {
+            const UPackage* Package = Target ? Target->GetOutermost() : nullptr;
+            if (!Package || Package == GetTransientPackage())
+            {
+                return;
+            }
+
+            const FName PackageName = Package->GetFName();
+            if (PackageName == Report.PackageName || FPackageName::IsScriptPackage(PackageName.ToString()))
+            {
+                return;
+            }
+
+            FGeoBlueprintJsonHardReference& Reference = Report.References.AddDefaulted_GetRef();
+            Reference.Kind = Kind;
+            Reference.TargetPath = Target->GetPathName();
+            Reference.TargetPackage = PackageName;
+            Reference.Node = Node;
+            Reference.VariableName = VariableName;
+
+            Reference.Closure = FindOrComputeClosure(Closures, PackageName);
+        }
+    };
+
+    static bool IsObjectPinCategory(FName PinCategory)
+    {
+        return PinCategory == UEdGraphSchema_K2::PC_Object || PinCategory == UEdGraphSchema_K2::PC_Class || PinCategory == UEdGraphSchema_K2::PC_Interface;
+    }
+}
+
+FGeoBlueprintJsonReferenceReport FGeoBlueprintJsonReferenceAnalysis::AnalyzeBlueprint(const UBlueprint* Blueprint, FGeoBlueprintJsonLoadClosureCache* ClosureCache)
+{
+    using namespace GeoBlueprintJsonReferenceAnalysis;
+
+    FGeoBlueprintJsonReferenceReport Report;
+    if (!Blueprint)
+    {
+        return Report;
+    }
+
+    Report.PackageName = Blueprint->GetOutermost()->GetFName();
+    FGeoBlueprintJsonLoadClosureCache LocalClosures;
+    FGeoBlueprintJsonLoadClosureCache& Closures = ClosureCache ? *ClosureCache : LocalClosures;
+    FReferenceCollector Collector{ Report, Closures };
+
+    TArray<UEdGraph*> Graphs;
+    Blueprint->GetAllGraphs(Graphs);
+    for (const UEdGraph* Graph : Graphs)
+    {
+        if (!Graph)
+        {
+            continue;
+        }
+
+        for (const UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (!Node)
+            {
+                continue;
+            }
+
+            if (const UK2Node_DynamicCast* CastNode = Cast<UK2Node_DynamicCast>(Node))
+            {
+                Collector.Add(TEXT("Cast"), CastNode->TargetType, Node);
+            }
+            else if (const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+            {
+                const UFunction* Function = CallNode->GetTargetFunction();
+                Collector.Add(TEXT("FunctionCall"), Function ? Function->GetOwnerClass() : nullptr, Node);
+            }
+
+            // Spawn nodes keep their class on the class pin, so it is found with the other pin defaults
+            const bool bSpawnNode = Node->IsA<UK2Node_SpawnActor>() || Node->IsA<UK2Node_SpawnActorFromClass>();
+            for (const UEdGraphPin* Pin : Node->Pins)
+            {
+                if (Pin && Pin->DefaultObject && Pin->LinkedTo.Num() == 0)
+                {
+                    Collector.Add(bSpawnNode ? TEXT("SpawnClass") : TEXT("PinDefault"), Pin->DefaultObject, Node);
+                }
+            }
+        }
+    }
+
+    // Soft object and class variables are a different pin category, so only hard ones get here
+    const UClass* GeneratedClass = Blueprint->GeneratedClass;
+    const UObject* Defaults = GeneratedClass ? GeneratedClass->GetDefaultObject(false) : nullptr;
+    for (const FBPVariableDescription& Variable : Blueprint->NewVariables)
+    {
+        if (!IsObjectPinCategory(Variable.VarType.PinCategory))
+        {
+            continue;
+        }
+
+        Collector.Add(TEXT("VariableType"), Variable.VarType.PinSubCategoryObject.Get(), nullptr, Variable.VarName);
+        const FObjectPropertyBase* Property = GeneratedClass ? FindFProperty<FObjectPropertyBase>(GeneratedClass, Variable.VarName) : nullptr;
+        if (Property && Defaults)
+        {
+            Collector.Add(TEXT("VariableDefault"), Property->GetObjectPropertyValue_InContainer(Defaults), nullptr, Variable.VarName);
+        }
+    }
+
+    Report.Closure = FindOrComputeClosure(Closures, Report.PackageName);
+    return Report;
+}
+
+FGeoBlueprintJsonLoadClosure FGeoBlueprintJsonReferenceAnalysis::ComputeLoadClosure(FName PackageName)
+{
+    FGeoBlueprintJsonLoadClosure Closure;
+    if (PackageName.IsNone())
+    {
+        return Closure;
+    }
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+    TSet<FName> Visited;
+    TArray<FName> Pending;
+    Visited.Add(PackageName);
+    Pending.Add(PackageName);
+
+    TArray<FName> Dependencies;
+    while (Pending.Num() > 0)
+    {
+        const FName Current = Pending.Pop(EAllowShrinking::No);
+        ++Closure.NumPackages;
+        if (const TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(Current))
+        {
+            Closure.DiskBytes += FMath::Max<int64>(0, PackageData->DiskSize);
+        }
+
+        Dependencies.Reset();
+        AssetRegistry.GetDependencies(Current, Dependencies, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+        for (const FName Dependency : Dependencies)
+        {
+            // Script packages are native modules, already loaded and with nothing on disk
+            bool bAlreadyVisited = false;
+            Visited.Add(Dependency, &bAlreadyVisited);
+            if (!bAlreadyVisited && !FPackageName::IsScriptPackage(Dependency.ToString()))
+            {
+                Pending.Add(Dependency);
+            }
+        }
+    }
+    return Closure;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UBlueprint;
+class UEdGraphNode;
+
+/** Packages that load together with a root package through hard references, the root included */
+struct FGeoBlueprintJsonLoadClosure
+{
+    int32 NumPackages = 0;
+
+    /** On-disk size from the Asset Registry; packages it has no size for count as zero */
+    int64 DiskBytes = 0;
+};
+
+/** Load closures by root package, for sharing the registry walks between the reports of one run */
+using FGeoBlueprintJsonLoadClosureCache = TMap<FName, FGeoBlueprintJsonLoadClosure>;
+
+/** One hard reference a Blueprint's nodes or variables introduce, with the closure it pulls in */
+struct FGeoBlueprintJsonHardReference
+{
+    /** Cast, SpawnClass, FunctionCall, PinDefault, VariableType or VariableDefault */
+    const TCHAR* Kind = TEXT("PinDefault");
+
+    FString TargetPath;
+    FName TargetPackage;
+
+    /** The node that introduced the reference; null for variables */
+    const UEdGraphNode* Node = nullptr;
+
+    /** The variable, for VariableType and VariableDefault */
+    FName VariableName;
+
+    FGeoBlueprintJsonLoadClosure Closure;
+};
+
+struct FGeoBlueprintJsonReferenceReport
+{
+    FName PackageName;
+
+    /** In graph order, then variable order. A target referenced by several nodes is listed once per node. */
+    TArray<FGeoBlueprintJsonHardReference> References;
+
+    /** Every hard package dependency the Asset Registry records, not only the ones listed above */
+    FGeoBlueprintJsonLoadClosure Closure;
+};
+
+/**
+ * Finds the hard references a Blueprint introduces: cast target classes, spawned classes, classes of
+ * called functions, object and class pin defaults, and object-typed variables and their defaults. Native
+ * classes are skipped since they are always loaded. References to the Blueprint's own package are
+ * skipped too.
+ *
+ * Load closures follow the Asset Registry's hard package dependencies transitively, so they are only
+ * as complete as the registry's last scan. Pass a ClosureCache when analyzing many Blueprints, so a
+ * package they share is walked once rather than once per report; it must not outlive a registry scan.
+ */
+class FGeoBlueprintJsonReferenceAnalysis
+{
+public:
+    static FGeoBlueprintJsonReferenceReport AnalyzeBlueprint(const UBlueprint* Blueprint, FGeoBlueprintJsonLoadClosureCache* ClosureCache = nullptr);
+
+    static FGeoBlueprintJsonLoadClosure ComputeLoadClosure(FName PackageName);
+};
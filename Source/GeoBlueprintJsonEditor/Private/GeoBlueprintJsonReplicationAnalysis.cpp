@@ -0,0 +1,174 @@
+#include "GeoBlueprintJsonReplicationAnalysis.h"
+#include "Components/ActorComponent.h"
+#include "Engine/Blueprint.h"
+#include "GameFramework/Actor.h"
+#include "UObject/CoreNet.h"
+#include "UObject/TextProperty.h"
+#include "UObject/UnrealType.h"
+
+namespace GeoBlueprintJsonReplicationAnalysis
+{
+    static constexpr int32 HandleBytes = 1;
+    static constexpr int32 BoolBytes = 1;
+    static constexpr int32 ObjectReferenceBytes = 4;
+    static constexpr int32 StringHeaderBytes = 4;
+    static constexpr int32 ArrayHeaderBytes = 2;
+
+    /** Structs rarely nest deeper; anything that does is counted at its in-memory size */
+    static constexpr int32 MaxStructDepth = 8;
+
+    static int32 EstimateContainerBytes(const FProperty* Property, const void* ContainerPtr, int32 Depth);
+
+    static int32 EstimateValueBytes(const FProperty* Property, const void* ValuePtr, int32 Depth)
+    {
+        if (Property->IsA<FBoolProperty>())
+        {
+            return BoolBytes;
+        }
+        if (Property->IsA<FObjectPropertyBase>())
+        {
+            return ObjectReferenceBytes;
+        }
+        if (const FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+        {
+            return StringHeaderBytes + StrProperty->GetPropertyValue(ValuePtr).Len();
+        }
+        if (const FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+        {
+            return StringHeaderBytes + NameProperty->GetPropertyValue(ValuePtr).GetStringLength();
+        }
+        if (const FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+        {
+            return StringHeaderBytes + TextProperty->GetPropertyValue(ValuePtr).ToString().Len();
+        }
+
+        if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+        {
+            FScriptArrayHelper ArrayHelper(ArrayProperty, ValuePtr);
+            int32 Bytes = ArrayHeaderBytes;
+            for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
+            {
+                Bytes += EstimateValueBytes(ArrayProperty->Inner, ArrayHelper.GetRawPtr(Index), Depth + 1);
+            }
+            return Bytes;
+        }
+
+        // A native net serializer usually packs tighter than the members, so the in-memory size bounds it
+        const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+        if (StructProperty && Depth < MaxStructDepth && !(StructProperty->Struct->StructFlags & STRUCT_NetSerializeNative))
+        {
+            int32 Bytes = 0;
+            for (TFieldIterator<FProperty> It(StructProperty->Struct); It; ++It)
+            {
+                if (!It->HasAnyPropertyFlags(CPF_RepSkip))
+                {
+                    Bytes += EstimateContainerBytes(*It, ValuePtr, Depth + 1);
+                }
+            }
+            return Bytes;
+        }
+
+        return Property->GetElementSize();
+    }
+
+    static int32 EstimateContainerBytes(const FProperty* Property, const void* ContainerPtr, int32 Depth)
+    {
+        int32 Bytes = 0;
+        for (int32 Index = 0; Index < Property->ArrayDim; ++Index)
+        {
+            Bytes += EstimateValueBytes(Property, Property->ContainerPtrToValuePtr<void>(ContainerPtr, Index), Depth);
+        }
+        return Bytes;
+    }
+}
+
+int32 FGeoBlueprintJsonReplicationAnalysis::EstimatePropertyBytes(const FProperty* Property, const void* ContainerPtr)
+{
+    return Property && ContainerPtr ? GeoBlueprintJsonReplicationAnalysis::EstimateContainerBytes(Property, ContainerPtr, 0) : 0;
+}
+
+FGeoBlueprintJsonReplicationReport FGeoBlueprintJsonReplicationAnalysis::AnalyzeBlueprint(const UBlueprint* Blueprint)
+{
+    using namespace GeoBlueprintJsonReplicationAnalysis;
+
+    FGeoBlueprintJsonReplicationReport Report;
+    UClass* GeneratedClass = Blueprint ? Blueprint->GeneratedClass.Get() : nullptr;
+    if (!GeneratedClass || !(GeneratedClass->IsChildOf<AActor>() || GeneratedClass->IsChildOf<UActorComponent>()))
+    {
+        return Report;
+    }
+
+    const UObject* Defaults = GeneratedClass->GetDefaultObject();
+    if (!Defaults)
+    {
+        return Report;
+    }
+    Report.bIsReplicable = true;
+
+    if (const AActor* ActorDefaults = Cast<AActor>(Defaults))
+    {
+        Report.bIsActor = true;
+        Report.bReplicates = ActorDefaults->GetIsReplicated();
+        Report.bReplicateMovement = ActorDefaults->IsReplicatingMovement();
+        Report.bAlwaysRelevant = ActorDefaults->bAlwaysRelevant;
+        Report.bOnlyRelevantToOwner = ActorDefaults->bOnlyRelevantToOwner;
+        Report.bNetUseOwnerRelevancy = ActorDefaults->bNetUseOwnerRelevancy;
+        Report.NetUpdateFrequency = ActorDefaults->GetNetUpdateFrequency();
+        Report.MinNetUpdateFrequency = ActorDefaults->GetMinNetUpdateFrequency();
+        Report.NetPriority = ActorDefaults->NetPriority;
+        Report.NetCullDistance = FMath::Sqrt(ActorDefaults->GetNetCullDistanceSquared());
+        Report.NetDormancy = ActorDefaults->NetDormancy;
+    }
+    else if (const UActorComponent* ComponentDefaults = Cast<UActorComponent>(Defaults))
+    {
+        Report.bReplicates = ComponentDefaults->GetIsReplicated();
+    }
+
+    // The same list the net driver builds its replication layout from, so native conditions are included
+    GeneratedClass->SetUpRuntimeReplicationData();
+    TArray<FLifetimeProperty> LifetimeProperties;
+    Defaults->GetLifetimeReplicatedProps(LifetimeProperties);
+
+    TMap<const FProperty*, ELifetimeCondition> Conditions;
+    for (const FLifetimeProperty& LifetimeProperty : LifetimeProperties)
+    {
+        if (GeneratedClass->ClassReps.IsValidIndex(LifetimeProperty.RepIndex))
+        {
+            Conditions.Add(GeneratedClass->ClassReps[LifetimeProperty.RepIndex].Property, LifetimeProperty.Condition);
+        }
+    }
+
+    for (TFieldIterator<FProperty> It(GeneratedClass); It; ++It)
+    {
+        if (!It->HasAnyPropertyFlags(CPF_Net))
+        {
+            continue;
+        }
+
+        FGeoBlueprintJsonReplicatedProperty& Replicated = Report.Properties.AddDefaulted_GetRef();
+        Replicated.Property = *It;
+        Replicated.Name = It->GetFName();
+        Replicated.OwnerClassName = It->GetOwnerClass()->GetFName();
+        Replicated.bDeclaredInBlueprint = It->GetOwnerClass() == GeneratedClass;
+        Replicated.RepNotifyFunc = It->RepNotifyFunc;
+        if (const ELifetimeCondition* Condition = Conditions.Find(*It))
+        {
+            Replicated.Condition = *Condition;
+        }
+        Replicated.EstimatedBytes = HandleBytes + EstimatePropertyBytes(*It, Defaults);
+
+        // Movement is only replicated while the actor asks for it, whatever its condition says
+        const bool bInactiveMovement = Report.bIsActor && !Report.bReplicateMovement && Replicated.Name == TEXT("ReplicatedMovement");
+        Replicated.bSentPerUpdate = Replicated.Condition != COND_InitialOnly && Replicated.Condition != COND_Never && !bInactiveMovement;
+
+        Report.NumBlueprintProperties += Replicated.bDeclaredInBlueprint ? 1 : 0;
+        Report.EstimatedBytesPerUpdate += Replicated.bSentPerUpdate ? Replicated.EstimatedBytes : 0;
+    }
+
+    // Components are sent with their owner, at its rate
+    if (Report.bIsActor && Report.bReplicates)
+    {
+        Report.EstimatedBytesPerSecond = static_cast<double>(Report.EstimatedBytesPerUpdate) * Report.NetUpdateFrequency;
+    }
+    return Report;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "UObject/CoreNetTypes.h"
+
+class FProperty;
+class UBlueprint;
+
+/** One replicated property of a Blueprint's generated class, inherited ones included */
+struct FGeoBlueprintJsonReplicatedProperty
+{
+    const FProperty* Property = nullptr;
+    FName Name;
+
+    /** The class that declares the property; a native class or a Blueprint in the class chain */
+    FName OwnerClassName;
+
+    /** Declared as a variable of this Blueprint rather than inherited */
+    bool bDeclaredInBlueprint = false;
+
+    ELifetimeCondition Condition = COND_None;
+    FName RepNotifyFunc;
+
+    /** Bytes of the property's default value on the wire, including its handle */
+    int32 EstimatedBytes = 0;
+
+    /** Sent on updates after the initial one; false for COND_InitialOnly and COND_Never */
+    bool bSentPerUpdate = true;
+};
+
+struct FGeoBlueprintJsonReplicationReport
+{
+    /** False for Blueprints that don't generate an actor or component class; everything else is then left empty */
+    bool bIsReplicable = false;
+
+    /** The actor settings below are only read for actor Blueprints */
+    bool bIsActor = false;
+
+    bool bReplicates = false;
+    bool bReplicateMovement = false;
+    bool bAlwaysRelevant = false;
+    bool bOnlyRelevantToOwner = false;
+    bool bNetUseOwnerRelevancy = false;
+    float NetUpdateFrequency = 0.0f;
+    float MinNetUpdateFrequency = 0.0f;
+    float NetPriority = 0.0f;
+    float NetCullDistance = 0.0f;
+    TEnumAsByte<ENetDormancy> NetDormancy = DORM_Never;
+
+    TArray<FGeoBlueprintJsonReplicatedProperty> Properties;
+
+    /** Properties this Blueprint declares, out of Properties */
+    int32 NumBlueprintProperties = 0;
+
+    /** Every property sent per update changing at once */
+    int32 EstimatedBytesPerUpdate = 0;
+
+    /** EstimatedBytesPerUpdate at NetUpdateFrequency, per replicated instance; zero for actors that don't replicate */
+    double EstimatedBytesPerSecond = 0.0;
+};
+
+/**
+ * Reads the replication settings of a Blueprint class without running it: the condition and RepNotify of
+ * every replicated property from the class's lifetime replication list, and for actors the update
+ * frequency, relevancy, priority, cull distance and dormancy defaults.
+ *
+ * Byte counts are an upper bound for comparing classes, not a measurement. Each property costs a 1 byte
+ * handle plus its size: 1 byte for a bool, 4 for an object reference, 4 plus the length for strings,
+ * names and text, the element size for other plain values, and for structs without a native net
+ * serializer the sum of their members. Arrays cost 2 bytes plus their default elements.
+ */
+class FGeoBlueprintJsonReplicationAnalysis
+{
+public:
+    static FGeoBlueprintJsonReplicationReport AnalyzeBlueprint(const UBlueprint* Blueprint);
+
+    /** Estimated bytes of one value of the property in the container, without the handle */
+    static int32 EstimatePropertyBytes(const FProperty* Property, const void* ContainerPtr);
+};
@@ -0,0 +1,441 @@
+#include "GeoBlueprintJsonShardCoordinator.h"
+#include "GeoBlueprintJsonBulkExporter.h"
+#include "GeoBlueprintJsonIndex.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+FGeoBlueprintJsonShardCoordinator::FGeoBlueprintJsonShardCoordinator(const FGeoBlueprintJsonBulkExportSettings& InSettings, int32 InNumShards, int32 InMaxRetriesPerShard)
+    : Settings(InSettings)
+    , NumShards(FMath::Max(1, InNumShards))
+    , MaxRetriesPerShard(FMath::Max(0, InMaxRetriesPerShard))
+{
+}
+
+int64 FGeoBlueprintJsonShardCoordinator::EstimateCost(const FAssetData& AssetData)
+{
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+    FAssetPackageData PackageData;
+    if (AssetRegistry.TryGetAssetPackageData(AssetData.PackageName, PackageData) == UE::AssetRegistry::EExists::Exists && PackageData.DiskSize > 0)
+    {
+        return PackageData.DiskSize;
+    }
+
+    // Unknown sizes still cost something so they spread across shards rather than piling onto one
+    return 1;
+}
+
+TArray<TArray<FName>> FGeoBlueprintJsonShardCoordinator::PartitionByEstimatedCost(const TArray<FAssetData>& Assets, int32 NumShards)
+{
+    struct FCostedAsset
+    {
+        FName PackageName;
+        int64 Cost;
+    };
+
+    TArray<FCostedAsset> CostedAssets;
+    CostedAssets.Reserve(Assets.Num());
+    for (const FAssetData& AssetData : Assets)
+    {
+        CostedAssets.Add({ AssetData.PackageName, EstimateCost(AssetData) });
+    }
+
+    // Ties are broken by name so the same project always produces the same shards
+    CostedAssets.Sort([](const FCostedAsset& A, const FCostedAsset& B)
+    {
+        return A.Cost != B.Cost ? A.Cost > B.Cost : A.PackageName.LexicalLess(B.PackageName);
+    });
+
+    TArray<TArray<FName>> Partitions;
+    TArray<int64> PartitionCosts;
+    Partitions.SetNum(FMath::Max(1, NumShards));
+    PartitionCosts.SetNumZeroed(Partitions.Num());
+
+    for (const FCostedAsset& CostedAsset : CostedAssets)
+    {
+        int32 CheapestIndex = 0;
+        for (int32 Index = 1; Index < PartitionCosts.Num(); ++Index)
+        {
+            if (PartitionCosts[Index] < PartitionCosts[CheapestIndex])
+            {
+                CheapestIndex = Index;
+            }
+        }
+        Partitions[CheapestIndex].Add(CostedAsset.PackageName);
+        PartitionCosts[CheapestIndex] += CostedAsset.Cost;
+    }
+
+    for (TArray<FName>& Partition : Partitions)
+    {
+        Partition.Sort(FNameLexicalLess());
+    }
+    return Partitions;
+}
+
+bool FGeoBlueprintJsonShardCoordinator::SaveShardList(const TArray<FName>& PackageNames, const FString& FilePath)
+{
+    TArray<FString> Lines;
+    Lines.Reserve(PackageNames.Num());
+    for (const FName PackageName : PackageNames)
+    {
+        Lines.Add(PackageName.ToString());
+    }
+    return FFileHelper::SaveStringArrayToFile(Lines, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+}
+
+bool FGeoBlueprintJsonShardCoordinator::LoadShardList(const FString& FilePath, TArray<FName>& OutPackageNames)
+{
+    TArray<FString> Lines;
+    if (!FFileHelper::LoadFileToStringArray(Lines, *FilePath))
+    {
+        return false;
+    }
+
+    for (FString& Line : Lines)
+    {
+        Line.TrimStartAndEndInline();
+        if (!Line.IsEmpty())
+        {
+            OutPackageNames.Add(FName(*Line));
+        }
+    }
+    return true;
+}
+
+FGeoBlueprintJsonBulkExportResult FGeoBlueprintJsonShardCoordinator::Run(const TArray<FAssetData>& Assets)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    FGeoBlueprintJsonBulkExportResult Result;
+
+    ObjectPathsByPackage.Reset();
+    for (const FAssetData& AssetData : Assets)
+    {
+        ObjectPathsByPackage.Add(AssetData.PackageName, AssetData.GetObjectPathString());
+    }
+
+    const FString ShardsRoot = FPaths::Combine(Settings.OutputDirectory, TEXT("Shards"));
+    IFileManager::Get().DeleteDirectory(*ShardsRoot, false, true);
+
+    TArray<TArray<FName>> Partitions = PartitionByEstimatedCost(Assets, NumShards);
+    for (int32 Index = 0; Index < Partitions.Num(); ++Index)
+    {
+        if (Partitions[Index].Num() == 0)
+        {
+            continue;
+        }
+
+        FShard& Shard = Shards.AddDefaulted_GetRef();
+        Shard.Index = Index;
+        Shard.PackageNames = MoveTemp(Partitions[Index]);
+        Shard.Directory = FPaths::Combine(ShardsRoot, FString::Printf(TEXT("Shard_%d"), Index));
+        Shard.ListFile = FPaths::Combine(ShardsRoot, FString::Printf(TEXT("Shard_%d.txt"), Index));
+        SaveShardList(Shard.PackageNames, Shard.ListFile);
+        LaunchShard(Shard);
+    }
+
+    bool bAnyRunning = true;
+    while (bAnyRunning)
+    {
+        bAnyRunning = false;
+        for (FShard& Shard : Shards)
+        {
+            if (Shard.bRunning && !FPlatformProcess::IsProcRunning(Shard.Process))
+            {
+                int32 ReturnCode = -1;
+                FPlatformProcess::GetProcReturnCode(Shard.Process, &ReturnCode);
+                FPlatformProcess::CloseProc(Shard.Process);
+                Shard.bRunning = false;
+
+                if (ReturnCode == 0 && HasShardOutput(Shard))
+                {
+                    Shard.bSucceeded = true;
+                    UE_LOG(LogTemp, Display, TEXT("Export shard %d finished (%d packages)"), Shard.Index, Shard.PackageNames.Num());
+                }
+                else if (Shard.Attempts <= MaxRetriesPerShard)
+                {
+                    UE_LOG(LogTemp, Warning, TEXT("Export shard %d failed with code %d, retrying"), Shard.Index, ReturnCode);
+                    ++Result.NumShardRetries;
+                    LaunchShard(Shard);
+                }
+                else
+                {
+                    UE_LOG(LogTemp, Error, TEXT("Export shard %d failed with code %d after %d attempts"), Shard.Index, ReturnCode, Shard.Attempts);
+                }
+            }
+            bAnyRunning |= Shard.bRunning;
+        }
+
+        if (bAnyRunning)
+        {
+            FPlatformProcess::Sleep(0.25f);
+        }
+    }
+
+    MergeShards(Result);
+    Result.ElapsedSeconds = static_cast<float>(FPlatformTime::Seconds() - StartTime);
+
+    UE_LOG(LogTemp, Log, TEXT("Sharded export finished: %d exported, %d failed across %d shards (%d retries) in %.1fs"),
+        Result.NumExported, Result.NumFailed, Shards.Num(), Result.NumShardRetries, Result.ElapsedSeconds);
+    return Result;
+}
+
+bool FGeoBlueprintJsonShardCoordinator::LaunchShard(FShard& Shard)
+{
+    // A failed attempt may have left partial output behind
+    IFileManager::Get().DeleteDirectory(*Shard.Directory, false, true);
+    ++Shard.Attempts;
+
+    // Workers share the machine, so each one gets an even slice of the overall budget
+    const int64 TotalBudgetMB = Settings.MemoryBudgetMB > 0
+        ? Settings.MemoryBudgetMB
+        : static_cast<int64>(FPlatformMemory::GetConstants().TotalPhysical / 4 * 3 / (1024 * 1024));
+    const int64 WorkerBudgetMB = FMath::Max<int64>(1, TotalBudgetMB / NumShards);
+
+    // Prefer the console build of the editor for workers even when coordinating from the GUI editor
+    FString Executable = FPlatformProcess::ExecutablePath();
+    const FString BaseName = FPaths::GetBaseFilename(Executable);
+    if (!BaseName.EndsWith(TEXT("-Cmd")))
+    {
+        const FString CmdExecutable = FPaths::Combine(FPaths::GetPath(Executable), BaseName + TEXT("-Cmd") + FPaths::GetExtension(Executable, true));
+        if (FPaths::FileExists(CmdExecutable))
+        {
+            Executable = CmdExecutable;
+        }
+    }
+
+    const FString ProjectFile = FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath());
+    FString Arguments = FString::Printf(
+        TEXT("\"%s\" -run=GeoBlueprintJsonExport -ShardList=\"%s\" -Output=\"%s\" -MemoryBudgetMB=%lld -PipelineDepth=%d -unattended -nopause -nosplash -nullrhi -stdout"),
+        *ProjectFile, *FPaths::ConvertRelativePathToFull(Shard.ListFile), *FPaths::ConvertRelativePathToFull(Shard.Directory), WorkerBudgetMB, Settings.PipelineDepth);
+    if (Settings.bWriteJsonLines)
+    {
+        Arguments += TEXT(" -JsonLines");
+    }
+    if (Settings.bShareInheritedData)
+    {
+        Arguments += TEXT(" -ShareInherited");
+    }
+
+    Shard.Process = FPlatformProcess::CreateProc(*Executable, *Arguments, false, true, true, nullptr, 0, nullptr, nullptr);
+    Shard.bRunning = Shard.Process.IsValid();
+    if (!Shard.bRunning)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Could not launch export shard %d (%s)"), Shard.Index, *Executable);
+    }
+    return Shard.bRunning;
+}
+
+bool FGeoBlueprintJsonShardCoordinator::HasShardOutput(const FShard& Shard) const
+{
+    // Workers write the summary last, so its presence means the manifest is complete
+    return FPaths::FileExists(FPaths::Combine(Shard.Directory, TEXT("Manifest.jsonl")))
+        && FPaths::FileExists(FPaths::Combine(Shard.Directory, TEXT("Summary.json")))
+        && (!Settings.bWriteJsonLines || FPaths::FileExists(FGeoBlueprintJsonIndexReader::GetIndexPath(FPaths::Combine(Shard.Directory, FGeoBlueprintJsonBulkExporter::JsonLinesFileName))));
+}
+
+void FGeoBlueprintJsonShardCoordinator::MergeShards(FGeoBlueprintJsonBulkExportResult& Result)
+{
+    struct FManifestLine
+    {
+        FString Key;
+        FString Line;
+    };
+
+    TArray<FManifestLine> ManifestLines;
+    TArray<TSharedPtr<FJsonValue>> ShardSummaries;
+    double TotalPeakMemoryMB = 0.0;
+
+    const FString JsonLinesPath = FPaths::Combine(Settings.OutputDirectory, FGeoBlueprintJsonBulkExporter::JsonLinesFileName);
+    TUniquePtr<FArchive> JsonLinesWriter;
+    FGeoBlueprintJsonIndexWriter IndexWriter;
+    if (Settings.bWriteJsonLines)
+    {
+        JsonLinesWriter.Reset(IFileManager::Get().CreateFileWriter(*JsonLinesPath));
+        if (!JsonLinesWriter)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Could not open merged export %s"), *JsonLinesPath);
+        }
+    }
+
+    for (const FShard& Shard : Shards)
+    {
+        TSharedRef<FJsonObject> ShardSummary = MakeShared<FJsonObject>();
+        ShardSummary->SetNumberField(TEXT("Shard"), Shard.Index);
+        ShardSummary->SetNumberField(TEXT("Packages"), Shard.PackageNames.Num());
+        ShardSummary->SetNumberField(TEXT("Attempts"), Shard.Attempts);
+
+        // A shard whose records didn't make it into the merged file is as lost as one that never finished
+        bool bSucceeded = Shard.bSucceeded;
+        if (bSucceeded && Settings.bWriteJsonLines && !AppendShardJsonLines(Shard, JsonLinesWriter, IndexWriter))
+        {
+            UE_LOG(LogTemp, Error, TEXT("Could not merge the JSON Lines output of export shard %d"), Shard.Index);
+            bSucceeded = false;
+        }
+        ShardSummary->SetBoolField(TEXT("Succeeded"), bSucceeded);
+
+        if (!bSucceeded)
+        {
+            // Keep the manifest complete: every package of a lost shard is reported as failed
+            for (const FName PackageName : Shard.PackageNames)
+            {
+                const FString AssetPath = ObjectPathsByPackage.FindRef(PackageName);
+
+                TSharedRef<FJsonObject> LineObject = MakeShared<FJsonObject>();
+                LineObject->SetStringField(TEXT("AssetPath"), AssetPath);
+                LineObject->SetStringField(TEXT("File"), FString());
+                LineObject->SetNumberField(TEXT("Bytes"), 0);
+                LineObject->SetStringField(TEXT("Status"), TEXT("Failed"));
+
+                FString Line;
+                TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Line);
+                FJsonSerializer::Serialize(LineObject, Writer);
+                ManifestLines.Add({ AssetPath, MoveTemp(Line) });
+                ++Result.NumFailed;
+            }
+            ShardSummaries.Add(MakeShared<FJsonValueObject>(ShardSummary));
+            continue;
+        }
+
+        TArray<FString> ShardLines;
+        FFileHelper::LoadFileToStringArray(ShardLines, *FPaths::Combine(Shard.Directory, TEXT("Manifest.jsonl")));
+        for (FString& Line : ShardLines)
+        {
+            TSharedPtr<FJsonObject> LineObject;
+            if (Line.IsEmpty() || !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Line), LineObject) || !LineObject.IsValid())
+            {
+                continue;
+            }
+
+            // Per-asset files move into the shared tree; paths in the manifest are relative, so the line itself is unchanged
+            const FString File = LineObject->GetStringField(TEXT("File"));
+            if (!File.IsEmpty() && !Settings.bWriteJsonLines)
+            {
+                IFileManager::Get().Move(*FPaths::Combine(Settings.OutputDirectory, File), *FPaths::Combine(Shard.Directory, File), true, true);
+            }
+            ManifestLines.Add({ LineObject->GetStringField(TEXT("AssetPath")), MoveTemp(Line) });
+        }
+
+        FString SummaryString;
+        TSharedPtr<FJsonObject> SummaryObject;
+        if (FFileHelper::LoadFileToString(SummaryString, *FPaths::Combine(Shard.Directory, TEXT("Summary.json")))
+            && FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(SummaryString), SummaryObject)
+            && SummaryObject.IsValid())
+        {
+            Result.NumExported += static_cast<int32>(SummaryObject->GetNumberField(TEXT("NumExported")));
+            Result.NumFailed += static_cast<int32>(SummaryObject->GetNumberField(TEXT("NumFailed")));
+            Result.NumGarbageCollections += static_cast<int32>(SummaryObject->GetNumberField(TEXT("NumGarbageCollections")));
+
+            const double ShardPeakMemoryMB = SummaryObject->GetNumberField(TEXT("PeakMemoryMB"));
+            Result.PeakMemoryMB = FMath::Max(Result.PeakMemoryMB, static_cast<float>(ShardPeakMemoryMB));
+            TotalPeakMemoryMB += ShardPeakMemoryMB;
+            ShardSummary->SetNumberField(TEXT("PeakMemoryMB"), ShardPeakMemoryMB);
+            ShardSummary->SetNumberField(TEXT("ElapsedSeconds"), SummaryObject->GetNumberField(TEXT("ElapsedSeconds")));
+        }
+        ShardSummaries.Add(MakeShared<FJsonValueObject>(ShardSummary));
+    }
+
+    // Sorting by asset path makes the merged manifest independent of shard count and completion order
+    ManifestLines.Sort([](const FManifestLine& A, const FManifestLine& B)
+    {
+        return A.Key < B.Key;
+    });
+
+    if (JsonLinesWriter)
+    {
+        // A failed append rewinds the writer, so whatever it left past that point belongs to no record
+        const int64 MergedSize = JsonLinesWriter->Tell();
+        const bool bHasPartialTail = MergedSize < JsonLinesWriter->TotalSize();
+        JsonLinesWriter->Close();
+        JsonLinesWriter.Reset();
+        if (bHasPartialTail)
+        {
+            TUniquePtr<IFileHandle> FileHandle(FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*JsonLinesPath, true));
+            if (!FileHandle || !FileHandle->Truncate(MergedSize))
+            {
+                UE_LOG(LogTemp, Error, TEXT("Could not trim the partial shard output at the end of %s"), *JsonLinesPath);
+            }
+        }
+        IndexWriter.Save(FGeoBlueprintJsonIndexReader::GetIndexPath(JsonLinesPath));
+    }
+
+    FString ManifestString;
+    for (const FManifestLine& ManifestLine : ManifestLines)
+    {
+        ManifestString += ManifestLine.Line;
+        ManifestString += TEXT("\n");
+    }
+    Result.ManifestPath = FPaths::Combine(Settings.OutputDirectory, TEXT("Manifest.jsonl"));
+    FFileHelper::SaveStringToFile(ManifestString, *Result.ManifestPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+
+    TSharedRef<FJsonObject> SummaryObject = MakeShared<FJsonObject>();
+    SummaryObject->SetNumberField(TEXT("NumExported"), Result.NumExported);
+    SummaryObject->SetNumberField(TEXT("NumFailed"), Result.NumFailed);
+    SummaryObject->SetNumberField(TEXT("NumGarbageCollections"), Result.NumGarbageCollections);
+    SummaryObject->SetNumberField(TEXT("PeakMemoryMB"), Result.PeakMemoryMB);
+    SummaryObject->SetNumberField(TEXT("TotalPeakMemoryMB"), TotalPeakMemoryMB);
+    SummaryObject->SetNumberField(TEXT("NumShards"), Shards.Num());
+    SummaryObject->SetNumberField(TEXT("NumShardRetries"), Result.NumShardRetries);
+    SummaryObject->SetArrayField(TEXT("Shards"), ShardSummaries);
+
+    FString SummaryString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&SummaryString);
+    FJsonSerializer::Serialize(SummaryObject, Writer);
+    FFileHelper::SaveStringToFile(SummaryString, *FPaths::Combine(Settings.OutputDirectory, TEXT("Summary.json")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+
+    // Shard scratch output is only kept around when something went wrong
+    if (Result.NumFailed == 0)
+    {
+        IFileManager::Get().DeleteDirectory(*FPaths::Combine(Settings.OutputDirectory, TEXT("Shards")), false, true);
+    }
+}
+
+bool FGeoBlueprintJsonShardCoordinator::AppendShardJsonLines(const FShard& Shard, const TUniquePtr<FArchive>& JsonLinesWriter, FGeoBlueprintJsonIndexWriter& IndexWriter)
+{
+    if (!JsonLinesWriter)
+    {
+        return false;
+    }
+
+    const FString ShardJsonLinesPath = FPaths::Combine(Shard.Directory, FGeoBlueprintJsonBulkExporter::JsonLinesFileName);
+    FGeoBlueprintJsonIndexReader ShardIndex;
+    TUniquePtr<FArchive> ShardReader(IFileManager::Get().CreateFileReader(*ShardJsonLinesPath));
+    if (!ShardReader || !ShardIndex.Open(ShardJsonLinesPath))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Export shard %d has no readable JSON Lines output"), Shard.Index);
+        return false;
+    }
+
+    const int64 BaseOffset = JsonLinesWriter->Tell();
+    TArray<uint8> Buffer;
+    Buffer.SetNumUninitialized(1024 * 1024);
+    for (int64 Remaining = ShardReader->TotalSize(); Remaining > 0 && !ShardReader->IsError() && !JsonLinesWriter->IsError();)
+    {
+        const int64 ChunkSize = FMath::Min<int64>(Remaining, Buffer.Num());
+        ShardReader->Serialize(Buffer.GetData(), ChunkSize);
+        JsonLinesWriter->Serialize(Buffer.GetData(), ChunkSize);
+        Remaining -= ChunkSize;
+    }
+
+    // The next shard overwrites whatever part of this one was copied
+    if (ShardReader->IsError() || JsonLinesWriter->IsError())
+    {
+        JsonLinesWriter->Seek(BaseOffset);
+        return false;
+    }
+
+    // Shard records keep their hashes; only their offsets move by where the shard lands in the merged file
+    for (const FGeoBlueprintJsonIndexEntry& Entry : ShardIndex.GetEntries())
+    {
+        IndexWriter.AddEntry(ShardIndex.GetKey(Entry), Entry.ContentHash, BaseOffset + Entry.Offset, Entry.Length);
+    }
+    return true;
+}
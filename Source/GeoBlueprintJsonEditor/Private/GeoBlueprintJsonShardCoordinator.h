@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "GeoBlueprintJsonBulkExport.h"
+#include "HAL/PlatformProcess.h"
+
+class FArchive;
+class FGeoBlueprintJsonIndexWriter;
+
+/**
+ * Splits a bulk export across local worker processes. Assets are partitioned into shards of
+ * similar estimated cost, each shard is exported by its own UnrealEditor-Cmd instance running
+ * the GeoBlueprintJsonExport commandlet, and the per-shard outputs are merged into a single
+ * output directory once every shard has finished. Failed shards are relaunched.
+ */
+class FGeoBlueprintJsonShardCoordinator
+{
+public:
+    FGeoBlueprintJsonShardCoordinator(const FGeoBlueprintJsonBulkExportSettings& InSettings, int32 InNumShards, int32 InMaxRetriesPerShard);
+
+    FGeoBlueprintJsonBulkExportResult Run(const TArray<FAssetData>& Assets);
+
+    /** Greedy longest-processing-time partition: the most expensive remaining asset goes to the cheapest shard */
+    static TArray<TArray<FName>> PartitionByEstimatedCost(const TArray<FAssetData>& Assets, int32 NumShards);
+
+    /** Estimated export cost of an asset, taken from its package size on disk */
+    static int64 EstimateCost(const FAssetData& AssetData);
+
+    /** Writes the package list a worker process reads through -ShardList= */
+    static bool SaveShardList(const TArray<FName>& PackageNames, const FString& FilePath);
+    static bool LoadShardList(const FString& FilePath, TArray<FName>& OutPackageNames);
+
+private:
+    struct FShard
+    {
+        int32 Index = 0;
+        TArray<FName> PackageNames;
+        FString Directory;
+        FString ListFile;
+        FProcHandle Process;
+        int32 Attempts = 0;
+        bool bRunning = false;
+        bool bSucceeded = false;
+    };
+
+    bool LaunchShard(FShard& Shard);
+    bool HasShardOutput(const FShard& Shard) const;
+    void MergeShards(FGeoBlueprintJsonBulkExportResult& Result);
+
+    /**
+     * Appends a shard's Export.jsonl to the merged one and re-adds its index entries at their new offsets.
+     * On failure nothing is indexed and the writer is rewound to where the shard started.
+     */
+    bool AppendShardJsonLines(const FShard& Shard, const TUniquePtr<FArchive>& JsonLinesWriter, FGeoBlueprintJsonIndexWriter& IndexWriter);
+
+    FGeoBlueprintJsonBulkExportSettings Settings;
+    int32 NumShards;
+    int32 MaxRetriesPerShard;
+    TArray<FShard> Shards;
+    TMap<FName, FString> ObjectPathsByPackage;
+};
@@ -0,0 +1,130 @@
+#include "GeoBlueprintJsonWidgetAnalysis.h"
+#include "GeoBlueprintJsonGraphMetrics.h"
+#include "Blueprint/WidgetTree.h"
+#include "Components/PanelWidget.h"
+#include "Components/Widget.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraphNode_Comment.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_FunctionTerminator.h"
+#include "K2Node_Knot.h"
+#include "WidgetBlueprint.h"
+
+namespace GeoBlueprintJsonWidgetAnalysis
+{
+    static constexpr double NodeCost = 1.0;
+    static constexpr double CallCost = 2.0;
+    static constexpr double CastCost = 4.0;
+    static constexpr double LoopCost = 10.0;
+    static constexpr double PropertyPathCost = 1.0;
+
+    static const UEdGraph* FindFunctionGraph(const UBlueprint* Blueprint, FName FunctionName)
+    {
+        for (const UEdGraph* Graph : Blueprint->FunctionGraphs)
+        {
+            if (Graph && Graph->GetFName() == FunctionName)
+            {
+                return Graph;
+            }
+        }
+        return nullptr;
+    }
+}
+
+void FGeoBlueprintJsonWidgetAnalysis::AnalyzeBindingGraph(const UEdGraph* Graph, FGeoBlueprintJsonBindingCost& OutCost)
+{
+    using namespace GeoBlueprintJsonWidgetAnalysis;
+
+    OutCost.Graph = Graph;
+    OutCost.NumNodes = 0;
+    OutCost.NumCalls = 0;
+    OutCost.NumCasts = 0;
+    OutCost.NumLoops = 0;
+    if (!Graph)
+    {
+        return;
+    }
+
+    for (const UEdGraphNode* Node : Graph->Nodes)
+    {
+        if (!Node || Node->IsA<UEdGraphNode_Comment>() || Node->IsA<UK2Node_Knot>() || Node->IsA<UK2Node_FunctionTerminator>())
+        {
+            continue;
+        }
+
+        ++OutCost.NumNodes;
+        OutCost.NumCalls += Node->IsA<UK2Node_CallFunction>() ? 1 : 0;
+        OutCost.NumCasts += FGeoBlueprintJsonGraphMetricsAnalysis::IsCastNode(Node) ? 1 : 0;
+        OutCost.NumLoops += FGeoBlueprintJsonGraphMetricsAnalysis::IsLoopNode(Node) ? 1 : 0;
+    }
+
+    OutCost.EstimatedCost = OutCost.NumNodes * NodeCost + OutCost.NumCalls * CallCost + OutCost.NumCasts * CastCost + OutCost.NumLoops * LoopCost;
+}
+
+FGeoBlueprintJsonWidgetBlueprintReport FGeoBlueprintJsonWidgetAnalysis::AnalyzeBlueprint(const UBlueprint* Blueprint)
+{
+    using namespace GeoBlueprintJsonWidgetAnalysis;
+
+    FGeoBlueprintJsonWidgetBlueprintReport Report;
+    const UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(Blueprint);
+    if (!WidgetBlueprint)
+    {
+        return Report;
+    }
+    Report.bIsWidgetBlueprint = true;
+
+    TMap<FName, int32> WidgetIndices;
+    if (const UWidgetTree* WidgetTree = WidgetBlueprint->WidgetTree)
+    {
+        // ForEachWidget visits panels before their children, so every parent already has its depth
+        WidgetTree->ForEachWidget([&Report, &WidgetIndices](UWidget* Widget)
+        {
+            FGeoBlueprintJsonWidgetInfo& Info = Report.Widgets.AddDefaulted_GetRef();
+            Info.Widget = Widget;
+            Info.Name = Widget->GetFName();
+            Info.bIsVariable = Widget->bIsVariable;
+            Info.bIsVolatile = Widget->bIsVolatile;
+            Info.Visibility = Widget->GetVisibility();
+            if (const UPanelWidget* Parent = Widget->GetParent())
+            {
+                Info.ParentName = Parent->GetFName();
+                const int32* ParentIndex = WidgetIndices.Find(Info.ParentName);
+                Info.Depth = ParentIndex ? Report.Widgets[*ParentIndex].Depth + 1 : 1;
+            }
+            WidgetIndices.Add(Info.Name, Report.Widgets.Num() - 1);
+        });
+    }
+
+    for (const FDelegateEditorBinding& Binding : WidgetBlueprint->Bindings)
+    {
+        FGeoBlueprintJsonBindingCost& Cost = Report.Bindings.AddDefaulted_GetRef();
+        Cost.WidgetName = Binding.ObjectName;
+        Cost.PropertyName = Binding.PropertyName;
+        Cost.bIsFunction = Binding.Kind == EBindingKind::Function;
+        Cost.FunctionName = Binding.FunctionName;
+        Cost.SourcePath = Binding.SourcePath.IsEmpty() ? Binding.SourceProperty.ToString() : Binding.SourcePath.GetDisplayText().ToString();
+
+        if (!Cost.bIsFunction)
+        {
+            Cost.EstimatedCost = PropertyPathCost;
+        }
+        else if (const UEdGraph* Graph = FindFunctionGraph(WidgetBlueprint, Binding.FunctionName))
+        {
+            AnalyzeBindingGraph(Graph, Cost);
+        }
+        else
+        {
+            // A function reached through a property path, which lives in another class
+            Cost.NumCalls = 1;
+            Cost.EstimatedCost = CallCost;
+        }
+        Report.EstimatedBindingCost += Cost.EstimatedCost;
+
+        if (const int32* WidgetIndex = WidgetIndices.Find(FName(*Binding.ObjectName)))
+        {
+            ++Report.Widgets[*WidgetIndex].NumBindings;
+        }
+    }
+
+    return Report;
+}
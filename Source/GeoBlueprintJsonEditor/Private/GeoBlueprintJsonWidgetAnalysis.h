@@ -0,0 +1,80 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SlateWrapperTypes.h"
+
+class UBlueprint;
+class UEdGraph;
+class UWidget;
+
+/** One widget of a Widget Blueprint's designer tree */
+struct FGeoBlueprintJsonWidgetInfo
+{
+    const UWidget* Widget = nullptr;
+    FName Name;
+
+    /** The panel the widget is a child of, or None for the root and named slot contents */
+    FName ParentName;
+
+    int32 Depth = 0;
+    bool bIsVariable = false;
+    bool bIsVolatile = false;
+    ESlateVisibility Visibility = ESlateVisibility::Visible;
+
+    /** Property bindings on this widget */
+    int32 NumBindings = 0;
+};
+
+/** One property binding and what evaluating it costs each frame the widget is visible */
+struct FGeoBlueprintJsonBindingCost
+{
+    FString WidgetName;
+    FName PropertyName;
+
+    /** Bound to a function of the Blueprint rather than a property path */
+    bool bIsFunction = false;
+    FName FunctionName;
+    FString SourcePath;
+
+    /** The bound function's graph, when it is a function of this Blueprint */
+    const UEdGraph* Graph = nullptr;
+
+    int32 NumNodes = 0;
+    int32 NumCalls = 0;
+    int32 NumCasts = 0;
+    int32 NumLoops = 0;
+
+    /** Relative per-frame cost, see FGeoBlueprintJsonWidgetAnalysis */
+    double EstimatedCost = 0.0;
+};
+
+struct FGeoBlueprintJsonWidgetBlueprintReport
+{
+    /** False for other Blueprints; everything else is then left empty */
+    bool bIsWidgetBlueprint = false;
+
+    /** Parents before children */
+    TArray<FGeoBlueprintJsonWidgetInfo> Widgets;
+    TArray<FGeoBlueprintJsonBindingCost> Bindings;
+
+    /** Sum of every binding's cost, paid once per frame per visible instance */
+    double EstimatedBindingCost = 0.0;
+};
+
+/**
+ * Reads a Widget Blueprint's designer tree and property bindings.
+ *
+ * Bindings are evaluated every frame for every visible widget, so their cost is scored from the
+ * bound function's graph: 1 per node other than entry, result, reroute and comment nodes, plus 2 per
+ * function call, 4 per cast and 10 per loop. A binding straight to a property path scores 1, and one
+ * to a function outside the Blueprint scores as a single call. Calls are not followed into the
+ * functions they call.
+ */
+class FGeoBlueprintJsonWidgetAnalysis
+{
+public:
+    static FGeoBlueprintJsonWidgetBlueprintReport AnalyzeBlueprint(const UBlueprint* Blueprint);
+
+    /** Fills the node counts and cost of a binding from its function graph */
+    static void AnalyzeBindingGraph(const UEdGraph* Graph, FGeoBlueprintJsonBindingCost& OutCost);
+};
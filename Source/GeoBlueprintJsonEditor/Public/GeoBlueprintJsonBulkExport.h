@@ -0,0 +1,97 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "GeoBlueprintJsonBulkExport.generated.h"
+
+USTRUCT(BlueprintType)
+struct FGeoBlueprintJsonBulkExportSettings
+{
+    GENERATED_BODY()
+
+    /** Long package paths searched for Blueprint assets */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geo|JSON")
+    TArray<FString> PackagePaths = { TEXT("/Game") };
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geo|JSON")
+    bool bRecursivePaths = true;
+
+    /** Directory receiving one JSON file per Blueprint plus the export manifest */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geo|JSON")
+    FString OutputDirectory;
+
+    /**
+     * Writes every asset into a single Export.jsonl instead, one line per Blueprint and per graph,
+     * with a binary Export.jsonl.idx that FGeoBlueprintJsonIndexReader uses to read single records
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geo|JSON")
+    bool bWriteJsonLines = false;
+
+    /** Resident memory budget in megabytes. Zero uses three quarters of physical memory. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geo|JSON")
+    int32 MemoryBudgetMB = 0;
+
+    /**
+     * Assets that may be converted ahead of the file writer. Deeper pipelines keep encoding and
+     * writing busy while the game thread gathers, at the cost of holding more exports in memory.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geo|JSON", meta = (ClampMin = "1"))
+    int32 PipelineDepth = 8;
+
+    /**
+     * Exports parent Blueprints before their children. A child whose parent is in the same export
+     * names it in ParentBlueprint and only lists the components it adds or changes, and every
+     * Blueprint carries its class defaults as a delta against its parent class.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geo|JSON")
+    bool bShareInheritedData = false;
+};
+
+USTRUCT(BlueprintType)
+struct FGeoBlueprintJsonBulkExportResult
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Geo|JSON")
+    int32 NumExported = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Geo|JSON")
+    int32 NumFailed = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Geo|JSON")
+    int32 NumGarbageCollections = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Geo|JSON")
+    int32 NumShardRetries = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Geo|JSON")
+    float PeakMemoryMB = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Geo|JSON")
+    float ElapsedSeconds = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Geo|JSON")
+    FString ManifestPath;
+};
+
+UCLASS()
+class GEOBLUEPRINTJSONEDITOR_API UGeoBlueprintJsonBulkExportLibrary : public UBlueprintFunctionLibrary
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Exports every Blueprint under the configured paths, one file per asset. Packages loaded by
+     * the export are released again and garbage is collected whenever resident memory exceeds the budget.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
+    static FGeoBlueprintJsonBulkExportResult ExportBlueprintsWithMemoryBudget(const FGeoBlueprintJsonBulkExportSettings& Settings);
+
+    /**
+     * Runs the same export across NumShards local UnrealEditor-Cmd worker processes and merges their
+     * output. Shards are balanced by package size on disk and a failed shard is relaunched up to
+     * MaxRetriesPerShard times. The memory budget is split evenly between the workers.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
+    static FGeoBlueprintJsonBulkExportResult ExportBlueprintsSharded(const FGeoBlueprintJsonBulkExportSettings& Settings, int32 NumShards, int32 MaxRetriesPerShard = 2);
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UBlueprint;
+class UEdGraph;
+class UEdGraphNode;
+class UEdGraphPin;
+struct FXxHash64Builder;
+
+/**
+ * Bottom-up content hashes for Blueprint graphs. A node hash covers the node class, its serialized
+ * properties and its pins with their types and defaults. A graph hash combines the hashes of its
+ * nodes and links, and a Blueprint hash combines its parent class and graph hashes. Identity and
+ * editor state (GUIDs, compiler messages) never count, and layout only counts when requested, so
+ * moving nodes around or resaving the package leaves every hash unchanged.
+ *
+ * Hashes are memoized per hasher, so a hasher must not outlive edits to the graphs it has seen.
+ */
+class GEOBLUEPRINTJSONEDITOR_API FGeoBlueprintJsonContentHasher
+{
+public:
+    explicit FGeoBlueprintJsonContentHasher(bool bInIncludeLayout = false);
+
+    uint64 HashNode(const UEdGraphNode* Node);
+
+    /** Independent of the order of the graph's node array */
+    uint64 HashGraph(const UEdGraph* Graph);
+
+    uint64 HashBlueprint(UBlueprint* Blueprint);
+
+    /** Fixed width lowercase hex, as written to the ContentHash fields of exports */
+    static FString ToString(uint64 Hash);
+
+private:
+    void HashPin(FXxHash64Builder& Builder, const UEdGraphPin* Pin) const;
+    bool IsHashedProperty(const FProperty* Property) const;
+
+    bool bIncludeLayout;
+    TMap<const UEdGraphNode*, uint64> NodeHashes;
+    TMap<const UEdGraph*, uint64> GraphHashes;
+};
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "GeoBlueprintJsonExportCommandlet.generated.h"
+
+/**
+ * Headless bulk export of Blueprint graphs.
+ *
+ * UnrealEditor-Cmd <Project> -run=GeoBlueprintJsonExport -Output=<Dir> [-Paths=/Game,/Plugin] [-MemoryBudgetMB=<MB>]
+ *     [-JsonLines] [-ShareInherited] [-Shards=<N> [-MaxRetries=<N>]]
+ * UnrealEditor-Cmd <Project> -run=GeoBlueprintJsonExport -Output=<Dir> -GraphMetrics|-ComponentCosts|-AnimAudit|-WidgetBindings|-Replication|-LoadCosts
+ *     [-Paths=...] [-MaxResults=<N>]
+ * UnrealEditor-Cmd <Project> -run=GeoBlueprintJsonExport -Output=<Dir> -CompileTimes [-Paths=...] [-MaxResults=<N>] [-Iterations=<N>]
+ * UnrealEditor-Cmd <Project> -run=GeoBlueprintJsonExport -Serve [-Port=<Port>]
+ *
+ * With -Shards the commandlet coordinates N worker processes of itself, each started with
+ * -ShardList=<File> naming the packages it should export.
+ *
+ * With -GraphMetrics it writes GraphMetrics.json, every graph ranked by cyclomatic complexity, and
+ * with -ComponentCosts it writes ComponentCosts.json, every actor Blueprint ranked by estimated
+ * per-instance cost, instead of exporting. With -AnimAudit it writes AnimAudit.json, every Animation
+ * Blueprint ranked by anim nodes off the fast path and thread-safety violations. With -WidgetBindings
+ * it writes WidgetBindings.json, every widget property binding ranked by estimated per-frame cost.
+ * With -Replication it writes Replication.json, every replicated actor and component Blueprint ranked
+ * by estimated bytes per second. With -LoadCosts it writes LoadCosts.json, every Blueprint ranked by the
+ * on-disk size of the packages its hard references load with it.
+ * With -CompileTimes it compiles every Blueprint and writes CompileTimes.json, ranked by median
+ * full compile time.
+ *
+ * With -Serve the commandlet runs the local export server instead, until a client sends a Shutdown
+ * request or the process is asked to exit.
+ */
+UCLASS()
+class UGeoBlueprintJsonExportCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UGeoBlueprintJsonExportCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+
+private:
+    int32 Serve(const FString& Params);
+};
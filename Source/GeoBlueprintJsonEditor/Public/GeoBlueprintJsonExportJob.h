@@ -0,0 +1,171 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "Containers/Ticker.h"
+#include "GeoBlueprintJsonGraphFunctionLibrary.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class FGeoJsonArena;
+class FGeoBlueprintJsonGraphExporter;
+class FGeoBlueprintJsonPackageTracker;
+class UBlueprint;
+class UEdGraph;
+class UObject;
+class UPackage;
+struct FGeoJsonArray;
+struct FGeoJsonObject;
+
+/** Where a time-sliced export stands */
+struct FGeoBlueprintJsonExportJobProgress
+{
+    int32 NumAssets = 0;
+    int32 NumExported = 0;
+    int32 NumFailed = 0;
+
+    /** Assets started over because they were edited, compiled or reloaded while being exported */
+    int32 NumRestarts = 0;
+
+    /** Of NumFailed, assets that kept changing until they ran out of restarts */
+    int32 NumRestartLimitFailures = 0;
+
+    int32 NumNodesExported = 0;
+    FSoftObjectPath CurrentAsset;
+
+    /** Game thread time spent in the last frame the job worked in, and since it started */
+    double LastFrameMs = 0.0;
+    double TotalGameThreadMs = 0.0;
+
+    float GetFraction() const { return NumAssets > 0 ? static_cast<float>(NumExported + NumFailed) / NumAssets : 1.0f; }
+};
+
+/**
+ * Exports Blueprints from the core ticker, spending at most a per-frame budget of game thread time, so
+ * large exports run in a running editor without hitches. Work is cut into steps of one node each, plus
+ * a step for each Blueprint's name and class fields, one for each header analysis the options enable
+ * and one for each graph's analyses. The Blueprint's ContentHash is combined from the graph hashes
+ * once every graph is done. A cursor keeps the current asset, analysis, graph and node between frames.
+ * A step always runs to completion, so a frame can only overrun the budget by one step.
+ *
+ * Packages are loaded asynchronously, and a finished Blueprint is encoded and written on a worker
+ * task. What the job's loads pulled in is released again once the asset is done with, so the next
+ * editor GC can reclaim it. An asset that is modified, compiled or reloaded mid-export is started over
+ * from its header on the next step, so every export reflects one consistent state. One that keeps
+ * changing fails after MaxRestartsPerAsset restarts. Assets that disappear are counted as failed.
+ *
+ * Files go to the same relative paths as the bulk export. The ticker holds the job until it completes
+ * or is cancelled, so callers can drop their reference once it has started.
+ */
+class GEOBLUEPRINTJSONEDITOR_API FGeoBlueprintJsonExportJob : public TSharedFromThis<FGeoBlueprintJsonExportJob>
+{
+public:
+    static constexpr float DefaultBudgetMs = 4.0f;
+    static constexpr int32 MaxRestartsPerAsset = 8;
+
+    DECLARE_MULTICAST_DELEGATE_OneParam(FOnProgress, const FGeoBlueprintJsonExportJobProgress&);
+    DECLARE_MULTICAST_DELEGATE_TwoParams(FOnAssetExported, const FAssetData&, const TArray<uint8>&);
+    DECLARE_MULTICAST_DELEGATE_OneParam(FOnFinished, const FGeoBlueprintJsonExportJobProgress&);
+
+    /** OutputDirectory may be empty, in which case exports are only handed to OnAssetExported */
+    FGeoBlueprintJsonExportJob(TArray<FAssetData> InAssets, const FString& InOutputDirectory,
+        const FGeoBlueprintJsonGraphExportOptions& InOptions = FGeoBlueprintJsonGraphExportOptions(), float InBudgetMs = DefaultBudgetMs);
+    ~FGeoBlueprintJsonExportJob();
+
+    void Start();
+
+    /** Stops at the current step and waits for exports already being written; OnCancelled fires before it returns */
+    void Cancel();
+
+    bool IsRunning() const { return TickerHandle.IsValid(); }
+    const FGeoBlueprintJsonExportJobProgress& GetProgress() const { return Progress; }
+
+    void SetBudgetMs(float InBudgetMs) { BudgetMs = FMath::Max(0.1f, InBudgetMs); }
+
+    /** After every frame the job worked in */
+    FOnProgress& OnProgress() { return ProgressDelegate; }
+
+    /** For each asset, in asset order, with its UTF-8 JSON, once it has been encoded and written */
+    FOnAssetExported& OnAssetExported() { return AssetExportedDelegate; }
+
+    FOnFinished& OnCompleted() { return CompletedDelegate; }
+    FOnFinished& OnCancelled() { return CancelledDelegate; }
+
+private:
+    enum class EStage : uint8
+    {
+        Load,
+        Header,
+        Analyses,
+        Graphs,
+        Encode
+    };
+
+    struct FEncode;
+
+    bool Tick(float DeltaTime);
+
+    /** Runs one step; false when the job has to wait for a later frame or has nothing left to do */
+    bool Step();
+    bool StepLoad();
+    void StepHeader();
+    void StepAnalyses();
+    void StepGraphs();
+    bool StepEncode();
+
+    /** Hands finished encodes to OnAssetExported in asset order */
+    void CollectEncodes();
+
+    void BeginAsset();
+    void RestartAsset();
+    void FailAsset();
+    void NextAsset();
+    void Finish(bool bCancelled);
+
+    bool IsCurrentPackage(const UObject* Object) const;
+    void OnObjectModified(UObject* Object);
+    void OnBlueprintPreCompile(UBlueprint* CompiledBlueprint);
+    void OnPackageLoaded(const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result);
+
+    TArray<FAssetData> Assets;
+    FString OutputDirectory;
+    FGeoBlueprintJsonGraphExportOptions Options;
+    float BudgetMs = DefaultBudgetMs;
+
+    // Cursor, kept between frames
+    int32 AssetIndex = 0;
+    EStage Stage = EStage::Load;
+    bool bLoadRequested = false;
+    bool bLoadFinished = false;
+    bool bRestartRequested = false;
+    int32 NumAssetRestarts = 0;
+    TWeakObjectPtr<UBlueprint> Blueprint;
+    int32 AnalysisIndex = 0;
+    TArray<TPair<TWeakObjectPtr<UEdGraph>, const TCHAR*>> Graphs;
+    int32 GraphIndex = 0;
+    int32 NodeIndex = 0;
+
+    // The current asset's export, rebuilt from scratch on a restart
+    TUniquePtr<FGeoJsonArena> Arena;
+    TUniquePtr<FGeoBlueprintJsonGraphExporter> Exporter;
+    FGeoJsonObject* BlueprintObject = nullptr;
+    FGeoJsonObject* GraphObject = nullptr;
+    FGeoJsonArray* NodesArray = nullptr;
+
+    /** Packages the job's own loads brought in */
+    TUniquePtr<FGeoBlueprintJsonPackageTracker> LoadedPackages;
+
+    /** Finished assets being encoded and written, oldest first */
+    TArray<TUniquePtr<FEncode>> Encodes;
+
+    FGeoBlueprintJsonExportJobProgress Progress;
+
+    FTSTicker::FDelegateHandle TickerHandle;
+    FDelegateHandle ObjectModifiedHandle;
+    FDelegateHandle PreCompileHandle;
+
+    FOnProgress ProgressDelegate;
+    FOnAssetExported AssetExportedDelegate;
+    FOnFinished CompletedDelegate;
+    FOnFinished CancelledDelegate;
+};
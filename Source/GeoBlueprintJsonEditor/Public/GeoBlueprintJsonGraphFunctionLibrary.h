@@ -0,0 +1,291 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "GeoBlueprintJsonGraphFunctionLibrary.generated.h"
+
+// Forward declarations
+class UEdGraphPin;
+class UEdGraphNode;
+class UEdGraph;
+class UK2Node;
+class UK2Node_CallFunction;
+class UK2Node_Variable;
+class UK2Node_Event;
+class UK2Node_CustomEvent;
+class UK2Node_IfThenElse;
+class UK2Node_ExecutionSequence;
+class UK2Node_Select;
+class UBlueprint;
+
+USTRUCT()
+struct FBlueprintNodeData
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    FString NodeName;
+
+    UPROPERTY()
+    FString NodeType;
+
+    UPROPERTY()
+    FVector2D Position;
+
+    UPROPERTY()
+    TArray<FString> InputPins;
+
+    UPROPERTY()
+    TArray<FString> OutputPins;
+
+    UPROPERTY()
+    TArray<FString> ConnectedNodes;
+
+    UPROPERTY()
+    TMap<FString, FString> NodeProperties;
+};
+
+/** Which links a neighborhood export follows */
+UENUM(BlueprintType)
+enum class EGeoBlueprintJsonEdgeFilter : uint8
+{
+    Exec,
+    Data,
+    Both
+};
+
+/** Which way a neighborhood export follows links: from input pins, from output pins, or both */
+UENUM(BlueprintType)
+enum class EGeoBlueprintJsonEdgeDirection : uint8
+{
+    Upstream,
+    Downstream,
+    Both
+};
+
+/**
+ * Optional analysis passes run alongside a graph export. All of them are off by default, so an export
+ * with default options carries the same fields as ConvertBlueprintGraphToJson always has.
+ */
+USTRUCT(BlueprintType)
+struct FGeoBlueprintJsonGraphExportOptions
+{
+    GENERATED_BODY()
+
+    /** Adds a ranked list of pure nodes that are evaluated more than once per execution to each graph */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geo|JSON")
+    bool bIncludePureNodeAnalysis = false;
+
+    /** Iterations assumed for a ForEachLoop/ForLoop/WhileLoop body when estimating evaluation counts */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geo|JSON")
+    int32 AssumedLoopIterations = 10;
+
+    /** Maximum number of pure nodes listed per graph */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geo|JSON")
+    int32 MaxPureNodeResults = 10;
+
+    /**
+     * Blueprint execution capture written by DumpBlueprintProfile. Matching nodes and function graphs
+     * get HitCount/TimeMs fields. When empty, a capture running in this session is used instead.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geo|JSON")
+    FString HeatProfileFile;
+
+    /** Adds ContentHash fields to the Blueprint, each graph and each node, see FGeoBlueprintJsonContentHasher */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geo|JSON")
+    bool bIncludeContentHashes = false;
+
+    /** Lets node positions and sizes change content hashes */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geo|JSON")
+    bool bIncludeLayoutInContentHashes = false;
+
+    /**
+     * Adds the actor Blueprint's component hierarchy as Components, with each component's tick, overlap,
+     * collision, physics and shadow settings and an estimated per-instance cost, and its Interfaces
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geo|JSON")
+    bool bIncludeComponents = false;
+
+    /** Adds a Metrics object to each graph: cyclomatic complexity, fan-in/out, longest exec chain, exec cycles and node counts */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geo|JSON")
+    bool bIncludeGraphMetrics = false;
+
+    /**
+     * Marks each anim graph node with FastPath and the SlowPathPins that run Blueprint logic, and adds an
+     * Animation summary of fast path use and function thread safety to Animation Blueprints
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geo|JSON")
+    bool bIncludeAnimAnalysis = false;
+
+    /**
+     * Adds a Widget Blueprint's designer tree as WidgetTree and its property bindings as Bindings, each
+     * with the estimated per-frame cost of its bound function
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geo|JSON")
+    bool bIncludeWidgetTree = false;
+
+    /**
+     * Adds a Replication object to actor and component Blueprints: net update frequency, relevancy and
+     * dormancy, each replicated property's condition, RepNotify and estimated size, and estimated bytes
+     * per update and per second
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geo|JSON")
+    bool bIncludeReplication = false;
+
+    /**
+     * Adds HardReferences, the classes and objects the Blueprint's casts, spawns, calls, pin defaults and
+     * variables force to load, and its LoadClosure from the Asset Registry's hard package dependencies
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geo|JSON")
+    bool bIncludeHardReferences = false;
+};
+
+/**
+ * Blueprint graph exports. These need the editor-only graph data, so they live in the editor module.
+ */
+UCLASS()
+class GEOBLUEPRINTJSONEDITOR_API UGeoBlueprintJsonGraphFunctionLibrary : public UBlueprintFunctionLibrary
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
+    static FString ConvertBlueprintGraphToJson(UBlueprint* Blueprint);
+
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
+    static FString ConvertBlueprintGraphToJsonWithOptions(UBlueprint* Blueprint, const FGeoBlueprintJsonGraphExportOptions& Options);
+
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
+    static FString ConvertBlueprintNodeToJson(UEdGraphNode* Node);
+
+    /**
+     * Exports the nodes within MaxHops links of Node, following only links of the filtered kind in the
+     * given direction, plus a Boundary entry for every link from them to a node left out. Only the
+     * neighborhood is visited, whatever the size of the graph.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
+    static FString ConvertNodeNeighborhoodToJson(UEdGraphNode* Node, int32 MaxHops = 2,
+        EGeoBlueprintJsonEdgeFilter EdgeFilter = EGeoBlueprintJsonEdgeFilter::Both, EGeoBlueprintJsonEdgeDirection Direction = EGeoBlueprintJsonEdgeDirection::Both);
+
+    /** ConvertNodeNeighborhoodToJson around the node with NodeGuid, in any graph the Blueprint export contains */
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
+    static FString ConvertNodeNeighborhoodToJsonByGuid(UBlueprint* Blueprint, const FString& NodeGuid, int32 MaxHops = 2,
+        EGeoBlueprintJsonEdgeFilter EdgeFilter = EGeoBlueprintJsonEdgeFilter::Both, EGeoBlueprintJsonEdgeDirection Direction = EGeoBlueprintJsonEdgeDirection::Both);
+
+    /**
+     * Ranks the pure nodes of every graph in a Blueprint by how often they are re-evaluated per
+     * execution of their exec chain, weighted by node cost
+     */
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
+    static FString AnalyzePureNodeEvaluations(UBlueprint* Blueprint, int32 MaxResults = 20, int32 AssumedLoopIterations = 10);
+
+    /** Structural metrics of each graph the Blueprint export contains */
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
+    static FString AnalyzeGraphMetrics(UBlueprint* Blueprint);
+
+    /**
+     * Loads every Blueprint under PackagePaths and ranks all of their graphs by cyclomatic complexity,
+     * then by longest exec chain. MaxResults of zero or less keeps every graph.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
+    static FString RankGraphMetrics(const TArray<FString>& PackagePaths, int32 MaxResults = 100);
+
+    /** The component hierarchy and cost flags the graph export writes under Components */
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
+    static FString AnalyzeComponentCosts(UBlueprint* Blueprint);
+
+    /**
+     * Loads every Blueprint under PackagePaths and ranks the actor Blueprints by the estimated
+     * per-instance cost of their components and actor tick. MaxResults of zero or less keeps every one.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
+    static FString RankComponentCosts(const TArray<FString>& PackagePaths, int32 MaxResults = 100);
+
+    /** The fast path and thread-safety audit the graph export writes under Animation; empty for other Blueprints */
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
+    static FString AnalyzeAnimBlueprint(UBlueprint* Blueprint);
+
+    /**
+     * Loads every Animation Blueprint under PackagePaths and ranks them by slow path nodes, then by
+     * thread-safety violations. MaxResults of zero or less keeps every one.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
+    static FString RankAnimBlueprints(const TArray<FString>& PackagePaths, int32 MaxResults = 100);
+
+    /** The widget tree and bindings the graph export writes for a Widget Blueprint; empty for other Blueprints */
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
+    static FString AnalyzeWidgetBindings(UBlueprint* Blueprint);
+
+    /**
+     * Loads every Widget Blueprint under PackagePaths and ranks all of their property bindings by
+     * estimated per-frame cost, the candidates for event-driven updates first. MaxResults of zero or
+     * less keeps every binding.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
+    static FString RankWidgetBindings(const TArray<FString>& PackagePaths, int32 MaxResults = 100);
+
+    /** The replication audit the graph export writes under Replication; empty for Blueprints that aren't actors or components */
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
+    static FString AnalyzeReplication(UBlueprint* Blueprint);
+
+    /**
+     * Loads every Blueprint under PackagePaths and ranks the replicated actor and component Blueprints by
+     * estimated bytes per second, then by bytes per update. MaxResults of zero or less keeps every one.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
+    static FString RankReplicationCosts(const TArray<FString>& PackagePaths, int32 MaxResults = 100);
+
+    /** The hard references and load closure the graph export writes with bIncludeHardReferences */
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
+    static FString AnalyzeHardReferences(UBlueprint* Blueprint);
+
+    /**
+     * Loads every Blueprint under PackagePaths and ranks them by the on-disk size of their load closure,
+     * then by its package count. MaxResults of zero or less keeps every one.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
+    static FString RankLoadCosts(const TArray<FString>& PackagePaths, int32 MaxResults = 100);
+
+    /**
+     * Compiles the Blueprint once to warm up, then Iterations more times, and reports the median and
+     * minimum time of a skeleton regeneration, a bytecode recompile and a full compile, with its function count, bytecode size and recompiled dependents
+     */
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
+    static FString ProfileBlueprintCompile(UBlueprint* Blueprint, int32 Iterations = 3);
+
+    /**
+     * Profiles the compile of every Blueprint under PackagePaths and ranks them by median full compile
+     * time. MaxResults of zero or less keeps every one.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
+    static FString RankBlueprintCompileTimes(const TArray<FString>& PackagePaths, int32 MaxResults = 100, int32 Iterations = 3);
+
+    /** Stable hash of a node's class, properties, pins and pin defaults. Node layout only counts with bIncludeLayout. */
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
+    static FString GetNodeContentHash(UEdGraphNode* Node, bool bIncludeLayout = false);
+
+    /** Hash of a graph's node and link hashes, independent of node order */
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
+    static FString GetGraphContentHash(UEdGraph* Graph, bool bIncludeLayout = false);
+
+    /** Hash of a Blueprint's parent class and graph hashes; unchanged by resaves that leave the graphs alone */
+    UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
+    static FString GetBlueprintContentHash(UBlueprint* Blueprint, bool bIncludeLayout = false);
+
+    static FString ConvertBlueprintPinToJson(UEdGraphPin* Pin);
+
+	UFUNCTION(BlueprintCallable, Category = "Geo|JSON")
+	static FString ExportAllAvailableNodesAsJson();
+
+private:
+    static TSharedPtr<FJsonObject> ConvertNodeToJsonObject(UEdGraphNode* Node);
+    static TSharedPtr<FJsonObject> ConvertPinToJsonObject(UEdGraphPin* Pin);
+    static TSharedPtr<FJsonObject> ConvertConnectionToJsonObject(UEdGraphPin* Pin);
+    static TSharedPtr<FJsonObject> ConvertFunctionCallNodeToJsonObject(UK2Node_CallFunction* Node);
+    static TSharedPtr<FJsonObject> ConvertVariableNodeToJsonObject(UK2Node_Variable* Node);
+    static TSharedPtr<FJsonObject> ConvertEventNodeToJsonObject(UK2Node_Event* Node);
+    static TSharedPtr<FJsonObject> ConvertCustomEventNodeToJsonObject(UK2Node_CustomEvent* Node);
+    static TSharedPtr<FJsonObject> ConvertIfThenElseNodeToJsonObject(UK2Node_IfThenElse* Node);
+    static TSharedPtr<FJsonObject> ConvertSequenceNodeToJsonObject(UK2Node_ExecutionSequence* Node);
+    static TSharedPtr<FJsonObject> ConvertSelectNodeToJsonObject(UK2Node_Select* Node);
+};